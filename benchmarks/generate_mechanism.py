@@ -0,0 +1,167 @@
+#!/usr/bin/env python
+"""
+Writes a synthetic ScalarNetwork problem: an input file with N species and M
+reactions, and the rate tables of its EEDF reactions.
+
+The reactions are a seeded random mix of
+  constant     A + B -> C + D         : k
+  arrhenius    A + B -> C + D         : {a*Tgas^b*exp(-c/Tgas)}
+  eedf         e + A -> e + B         : EEDF (tabulated against reduced_field)
+  three_body   A + B + M -> C + M     : k  (M is the untracked background gas)
+with rates small enough that every case integrates without trouble, so that
+the run time measures the cost of the network rather than of the solver.
+
+The deck couples every species in a full SMP preconditioner, which is dense
+in the number of species; --preconditioning none leaves the [Preconditioning]
+block out, e.g. for sparse_preconditioning (which adds its own) or for sizes
+at which the full matrix no longer fits.
+
+Usage: generate_mechanism.py --species 100 --reactions 300 --output case100
+"""
+
+from __future__ import print_function
+
+import argparse
+import math
+import os
+import random
+
+KINDS = ['constant', 'arrhenius', 'eedf', 'three_body']
+
+
+def parse_mix(text):
+    """Parses 'constant=0.4,arrhenius=0.3,...' into normalized weights."""
+    mix = dict((kind, 0.0) for kind in KINDS)
+    for item in text.split(','):
+        kind, weight = item.split('=')
+        if kind not in mix:
+            raise ValueError('Unknown reaction kind: ' + kind)
+        mix[kind] = float(weight)
+    total = sum(mix.values())
+    if total <= 0.0:
+        raise ValueError('The reaction mix must have a positive weight.')
+    return [(kind, mix[kind] / total) for kind in KINDS]
+
+
+def pick_kind(rng, mix):
+    x = rng.random()
+    for kind, weight in mix:
+        if x < weight:
+            return kind
+        x -= weight
+    return mix[-1][0]
+
+
+def make_reactions(num_species, num_reactions, mix, rng):
+    species = ['S%d' % i for i in range(num_species)]
+    reactions = []
+    seen = set()
+    attempts = 0
+    while len(reactions) < num_reactions:
+        attempts += 1
+        if attempts > 100 * num_reactions:
+            raise RuntimeError('Too few species for %d distinct reactions.' % num_reactions)
+
+        kind = pick_kind(rng, mix)
+        a, b, c, d = [rng.choice(species) for _ in range(4)]
+        if kind == 'eedf':
+            if a == c:
+                continue
+            label = 'e + %s -> e + %s' % (a, c)
+            rate = 'EEDF'
+        elif kind == 'three_body':
+            label = '%s + %s + M -> %s + M' % (a, b, c)
+            rate = '%.3e' % (10 ** rng.uniform(-33, -31))
+        else:
+            if sorted([a, b]) == sorted([c, d]):
+                continue
+            label = '%s + %s -> %s + %s' % (a, b, c, d)
+            if kind == 'constant':
+                rate = '%.3e' % (10 ** rng.uniform(-13, -11))
+            else:
+                rate = '{%.3e*Tgas^(%.2f)*exp(-%.1f/Tgas)}' % (10 ** rng.uniform(-14, -12),
+                                                            rng.uniform(-1.0, 1.0),
+                                                            rng.uniform(0.0, 500.0))
+        if label in seen:
+            continue
+        seen.add(label)
+        reactions.append((kind, label, rate))
+    return species, reactions
+
+
+def write_table(path, rng):
+    """Rate coefficient against reduced field, k = k0 exp(-E0/E)."""
+    k0 = 10 ** rng.uniform(-10, -8)
+    e0 = 10 ** rng.uniform(-21, -20)
+    with open(path, 'w') as f:
+        for j in range(200):
+            field = 1e-22 * 10 ** (4.0 * j / 199)
+            f.write('%.4e %.4e\n' % (field, k0 * math.exp(-e0 / field)))
+
+
+def write_case(output, num_species, num_reactions, mix, seed, steps, dt, preconditioning='full',
+               input_file='mechanism.i'):
+    rng = random.Random(seed)
+    species, reactions = make_reactions(num_species, num_reactions, mix, rng)
+    tables = os.path.join(output, 'tables')
+    if not os.path.isdir(tables):
+        os.makedirs(tables)
+    for kind, label, rate in reactions:
+        if kind == 'eedf':
+            write_table(os.path.join(tables, 'reaction_%s.txt' % label), rng)
+
+    lines = []
+    lines += ['[Mesh]', '  type = GeneratedMesh', '  dim = 1', '  nx = 1', '[]', '']
+    lines += ['[Variables]']
+    for s in species:
+        lines += ['  [./%s]' % s, '    family = SCALAR', '    order = FIRST',
+                  '    initial_condition = %.3e' % (10 ** rng.uniform(8, 12)), '  [../]']
+    lines += ['[]', '']
+    lines += ['[AuxVariables]']
+    for name, value in [('e', 1e10), ('Tgas', 300.0), ('reduced_field', 1e-20)]:
+        lines += ['  [./%s]' % name, '    family = SCALAR', '    order = FIRST',
+                  '    initial_condition = %g' % value, '  [../]']
+    lines += ['[]', '']
+    lines += ['[ChemicalReactions]', '  [./ScalarNetwork]',
+              "    species = '%s'" % ' '.join(['e'] + species),
+              "    aux_species = 'e'",
+              "    file_location = 'tables'",
+              "    sampling_variable = 'reduced_field'",
+              "    equation_variables = 'Tgas'",
+              '    time_derivatives = true',
+              "    reactions = '" + '\n                 '.join(
+                  '%s : %s' % (label, rate) for kind, label, rate in reactions) + "'",
+              '  [../]', '[]', '']
+    lines += ['[Executioner]', '  type = Transient', "  solve_type = 'newton'",
+              '  num_steps = %d' % steps, '  dt = %g' % dt, '[]', '']
+    if preconditioning == 'full':
+        lines += ['[Preconditioning]', '  [./smp]', '    type = SMP', '    full = true', '  [../]', '[]', '']
+    lines += ['[Outputs]', '  print_perf_log = true', '[]']
+
+    path = os.path.join(output, input_file)
+    with open(path, 'w') as f:
+        f.write('\n'.join(lines) + '\n')
+    return path
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Writes a synthetic ScalarNetwork problem.')
+    parser.add_argument('--species', type=int, required=True, help='Number of species')
+    parser.add_argument('--reactions', type=int, help='Number of reactions (default 3 per species)')
+    parser.add_argument('--mix', default='constant=0.4,arrhenius=0.3,eedf=0.2,three_body=0.1',
+                        help='Relative weights of the reaction kinds')
+    parser.add_argument('--seed', type=int, default=1, help='Random seed')
+    parser.add_argument('--steps', type=int, default=10, help='Number of time steps')
+    parser.add_argument('--dt', type=float, default=1e-9, help='Time step (s)')
+    parser.add_argument('--preconditioning', default='full', choices=['full', 'none'],
+                        help='Full SMP preconditioning block, or none (for sparse_preconditioning)')
+    parser.add_argument('--output', required=True, help='Directory the case is written to')
+    args = parser.parse_args()
+
+    reactions = args.reactions if args.reactions else 3 * args.species
+    print(write_case(args.output, args.species, reactions, parse_mix(args.mix), args.seed, args.steps, args.dt,
+                     args.preconditioning))
+
+
+if __name__ == '__main__':
+    main()
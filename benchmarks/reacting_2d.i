@@ -0,0 +1,129 @@
+# Argon reaction-diffusion on a 2D mesh, used by run_scaling.py to time the
+# threaded assembly of an AddReactions network (EEDF and constant rate
+# materials, log-form reaction kernels). The reduced field varies across the
+# domain so that every element samples the rate tables at a different point.
+# Densities are in m^-3 and rate coefficients in m^3/s, as in the tables.
+# run_scaling.py sets the mesh size and the number of threads on the command
+# line; the postprocessors are compared between thread counts.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 64
+  ny = 64
+  xmax = 1
+  ymax = 1
+[]
+
+[Variables]
+  [./e]
+    initial_condition = 36.84
+  [../]
+  [./Ar+]
+    initial_condition = 36.84
+  [../]
+  [./Ar*]
+    initial_condition = 34.54
+  [../]
+[]
+
+[AuxVariables]
+  [./reduced_field]
+  [../]
+[]
+
+[ICs]
+  [./reduced_field]
+    type = FunctionIC
+    variable = reduced_field
+    function = '1e-20 + 2e-20 * x * y'
+  [../]
+[]
+
+[Kernels]
+  [./e_time]
+    type = TimeDerivativeLog
+    variable = e
+  [../]
+  [./e_diffusion]
+    type = Diffusion
+    variable = e
+  [../]
+  [./Ar+_time]
+    type = TimeDerivativeLog
+    variable = Ar+
+  [../]
+  [./Ar+_diffusion]
+    type = Diffusion
+    variable = Ar+
+  [../]
+  [./Ar*_time]
+    type = TimeDerivativeLog
+    variable = Ar*
+  [../]
+  [./Ar*_diffusion]
+    type = Diffusion
+    variable = Ar*
+  [../]
+[]
+
+[ChemicalReactions]
+  [./Network]
+    species = 'e Ar+ Ar*'
+    use_log = true
+    electron_density = 'e'
+    reaction_coefficient_format = 'rate'
+    file_location = '../problems/Example3'
+    sampling_variable = 'reduced_field'
+    reactions = 'e + Ar -> e + e + Ar+   : EEDF
+                 e + Ar -> Ar* + e       : EEDF
+                 e + Ar* -> Ar + e       : EEDF
+                 e + Ar* -> Ar+ + e + e  : EEDF
+                 Ar+ + e -> Ar*          : 1e-17
+                 Ar* + Ar* -> Ar+ + e    : 6.0e-16'
+  [../]
+[]
+
+[Materials]
+  [./gas]
+    type = GenericConstantMaterial
+    prop_names = 'n_gas massem'
+    prop_values = '2.447e25 9.11e-31'
+  [../]
+[]
+
+[Postprocessors]
+  [./e]
+    type = ElementIntegralVariablePostprocessor
+    variable = e
+  [../]
+  [./Ar+]
+    type = ElementIntegralVariablePostprocessor
+    variable = Ar+
+  [../]
+  [./Ar*]
+    type = ElementIntegralVariablePostprocessor
+    variable = Ar*
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'newton'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  num_steps = 5
+  dt = 1e-9
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Outputs]
+  csv = true
+  print_perf_log = true
+[]
@@ -0,0 +1,152 @@
+#!/usr/bin/env python
+"""
+Times Crane on synthetic mechanisms of increasing size and writes the results
+to JSON for regression tracking.
+
+For every size (and every variant of the ScalarNetwork options) a case is
+generated with generate_mechanism.py and run with the performance log enabled.
+The JSON records the wall time of the run and every event of the performance
+log summary (calls, time without and with sub-events), among them the setup
+of the problem, the residual and Jacobian evaluations and the "Crane" events
+(rate updates, EEDF sampling, network assembly).
+
+The kernels and fused variants run with a full SMP preconditioner up to
+--full-coupling-limit species and with MOOSE's default (diagonal) one beyond;
+fused_sparse runs without a [Preconditioning] block, since
+sparse_preconditioning adds its own.
+
+Usage: run_benchmarks.py --executable ../crane-opt --sizes 10 100 1000 --output results.json
+"""
+
+from __future__ import print_function
+
+import argparse
+import json
+import os
+import platform
+import re
+import subprocess
+import sys
+import time
+
+from generate_mechanism import parse_mix, write_case
+
+# "| Event   nCalls  time  avg  time  avg  %  % |" rows of a PerfLog summary
+EVENT = re.compile(r'^\|\s{3,}(\S.*?)\s+(\d+)\s+([\d.eE+-]+)\s+([\d.eE+-]+)\s+([\d.eE+-]+)\s+([\d.eE+-]+)\s+([\d.eE+-]+)\s+([\d.eE+-]+)\s*\|\s*$')
+HEADER = re.compile(r'^\|\s(\S.*?)\s*\|\s*$')
+
+VARIANTS = {
+    'kernels': [],
+    'fused': ['ChemicalReactions/ScalarNetwork/fused_network=true'],
+    'fused_sparse': ['ChemicalReactions/ScalarNetwork/fused_network=true',
+                     'ChemicalReactions/ScalarNetwork/sparse_preconditioning=true'],
+}
+
+
+def preconditioning(variant, size, full_coupling_limit):
+    """The [Preconditioning] block of the deck of a variant: 'full' or 'none'."""
+    if any(arg.endswith('sparse_preconditioning=true') for arg in VARIANTS[variant]):
+        return 'none'
+    return 'full' if size <= full_coupling_limit else 'none'
+
+
+def parse_perf_log(output):
+    """Returns {'header/event': {...}} for every event of the perf log summaries."""
+    events = {}
+    header = None
+    for line in output.splitlines():
+        match = EVENT.match(line)
+        if match and header:
+            name = '%s/%s' % (header, match.group(1))
+            events[name] = {'calls': int(match.group(2)),
+                            'time': float(match.group(3)),
+                            'time_with_sub': float(match.group(5))}
+            continue
+        match = HEADER.match(line)
+        if match and not match.group(1).startswith(('Event', 'Alive', '-')) and 'Performance' not in match.group(1):
+            header = match.group(1)
+    return events
+
+
+def summarize(events):
+    """Totals of the events that the tracked quantities are made of."""
+    def total(pattern):
+        regex = re.compile(pattern, re.IGNORECASE)
+        return sum(e['time_with_sub'] for name, e in events.items() if regex.search(name))
+
+    return {'setup': total(r'^setup/'),
+            'residual': total(r'/compute ?residual$|/network residual$'),
+            'jacobian': total(r'/compute ?jacobian$|/network jacobian$'),
+            'rate_updates': total(r'^crane/(arrhenius rates|eedf rate sampling|boltzmann solver)$')}
+
+
+def run_case(executable, directory, extra_args, repeats, input_file='mechanism.i'):
+    best = None
+    output = ''
+    for _ in range(repeats):
+        start = time.time()
+        process = subprocess.Popen([executable, '-i', input_file] + extra_args,
+                                   cwd=directory, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+        stdout = process.communicate()[0].decode('utf-8', 'replace')
+        elapsed = time.time() - start
+        if process.returncode != 0:
+            sys.stderr.write(stdout[-4000:])
+            raise RuntimeError('%s failed in %s' % (executable, directory))
+        if best is None or elapsed < best:
+            best = elapsed
+            output = stdout
+    return best, output
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Times Crane on synthetic mechanisms.')
+    parser.add_argument('--executable', required=True, help='The Crane executable')
+    parser.add_argument('--sizes', type=int, nargs='+', default=[10, 100, 1000, 10000], help='Numbers of species')
+    parser.add_argument('--reactions-per-species', type=float, default=3.0, help='Reactions per species')
+    parser.add_argument('--mix', default='constant=0.4,arrhenius=0.3,eedf=0.2,three_body=0.1',
+                        help='Relative weights of the reaction kinds')
+    parser.add_argument('--variants', nargs='+', default=['kernels', 'fused'], choices=sorted(VARIANTS),
+                        help='ScalarNetwork options to time')
+    parser.add_argument('--full-coupling-limit', type=int, default=1000,
+                        help='Largest number of species preconditioned with a full SMP')
+    parser.add_argument('--steps', type=int, default=10, help='Time steps per run')
+    parser.add_argument('--repeats', type=int, default=3, help='Runs per case (the fastest is kept)')
+    parser.add_argument('--seed', type=int, default=1, help='Random seed of the mechanisms')
+    parser.add_argument('--work-dir', default='benchmark_cases', help='Directory the cases are written to')
+    parser.add_argument('--output', default='benchmark_results.json', help='JSON results file')
+    args = parser.parse_args()
+
+    executable = os.path.abspath(args.executable)
+    mix = parse_mix(args.mix)
+    results = {'executable': executable,
+               'host': platform.node(),
+               'date': time.strftime('%Y-%m-%dT%H:%M:%S'),
+               'steps': args.steps,
+               'mix': dict(mix),
+               'cases': []}
+
+    for size in args.sizes:
+        num_reactions = int(round(args.reactions_per_species * size))
+        directory = os.path.join(args.work_dir, 'species%d' % size)
+        for variant in args.variants:
+            coupling = preconditioning(variant, size, args.full_coupling_limit)
+            input_file = 'mechanism_%s.i' % coupling
+            write_case(directory, size, num_reactions, mix, args.seed, args.steps, 1e-9, coupling, input_file)
+            wall_time, output = run_case(executable, directory, VARIANTS[variant], args.repeats, input_file)
+            events = parse_perf_log(output)
+            case = {'species': size,
+                    'reactions': num_reactions,
+                    'variant': variant,
+                    'preconditioning': coupling,
+                    'wall_time': wall_time}
+            case.update(summarize(events))
+            case['events'] = events
+            results['cases'].append(case)
+            print('%6d species %7d reactions %-12s %10.3f s' % (size, num_reactions, variant, wall_time))
+
+    with open(args.output, 'w') as f:
+        json.dump(results, f, indent=2, sort_keys=True)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,108 @@
+#!/usr/bin/env python
+"""
+Strong-scaling test of a spatial reacting problem under MOOSE threading.
+
+reacting_2d.i (an AddReactions network with EEDF and constant rates on a 2D
+mesh) is run on one process with --n-threads set to each of the thread
+counts. The JSON records, for every count, the best wall time, the speedup
+and parallel efficiency relative to one thread, and the performance log
+events (residual and Jacobian assembly among them).
+
+The postprocessors of every run are compared with those of the one-thread
+run. Threads only change the order in which the element contributions are
+summed, so the values must agree to round-off; a larger difference points to
+state shared between threads and fails the test.
+
+Usage: run_scaling.py --executable ../crane-opt --threads 1 2 4 8 16 32 --output scaling_results.json
+"""
+
+from __future__ import print_function
+
+import argparse
+import csv
+import json
+import os
+import platform
+import sys
+import time
+
+from run_benchmarks import parse_perf_log, run_case, summarize
+
+
+def read_postprocessors(directory, file_base):
+    """The last row of the postprocessor CSV as {name: value}."""
+    with open(os.path.join(directory, file_base + '.csv')) as f:
+        rows = list(csv.DictReader(f))
+    return dict((name, float(value)) for name, value in rows[-1].items() if name != 'time')
+
+
+def max_relative_difference(values, reference):
+    return max(abs(values[name] - reference[name]) / max(abs(reference[name]), 1e-300)
+               for name in reference)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Strong scaling of a 2D reacting problem over threads.')
+    parser.add_argument('--executable', required=True, help='The Crane executable')
+    parser.add_argument('--threads', type=int, nargs='+', default=[1, 2, 4, 8, 16, 32], help='Thread counts')
+    parser.add_argument('--elements', type=int, default=128, help='Elements along each side of the mesh')
+    parser.add_argument('--steps', type=int, default=5, help='Time steps per run')
+    parser.add_argument('--repeats', type=int, default=3, help='Runs per thread count (the fastest is kept)')
+    parser.add_argument('--tolerance', type=float, default=1e-8,
+                        help='Largest relative difference of the postprocessors from the one-thread run')
+    parser.add_argument('--output', default='scaling_results.json', help='JSON results file')
+    args = parser.parse_args()
+
+    if args.threads[0] != 1:
+        args.threads.insert(0, 1)
+
+    executable = os.path.abspath(args.executable)
+    directory = os.path.dirname(os.path.abspath(__file__))
+    results = {'executable': executable,
+               'host': platform.node(),
+               'date': time.strftime('%Y-%m-%dT%H:%M:%S'),
+               'elements': args.elements * args.elements,
+               'steps': args.steps,
+               'cases': []}
+
+    reference = None
+    serial_time = None
+    failed = False
+    for threads in args.threads:
+        file_base = 'reacting_2d_threads%d' % threads
+        extra_args = ['--n-threads=%d' % threads,
+                      'Mesh/nx=%d' % args.elements,
+                      'Mesh/ny=%d' % args.elements,
+                      'Executioner/num_steps=%d' % args.steps,
+                      'Outputs/file_base=%s' % file_base]
+        wall_time, output = run_case(executable, directory, extra_args, args.repeats, 'reacting_2d.i')
+        values = read_postprocessors(directory, file_base)
+        if reference is None:
+            reference = values
+            serial_time = wall_time
+        difference = max_relative_difference(values, reference)
+
+        events = parse_perf_log(output)
+        case = {'threads': threads,
+                'wall_time': wall_time,
+                'speedup': serial_time / wall_time,
+                'efficiency': serial_time / wall_time / threads,
+                'max_relative_difference': difference,
+                'postprocessors': values}
+        case.update(summarize(events))
+        case['events'] = events
+        results['cases'].append(case)
+        print('%3d threads %10.3f s  speedup %6.2f  efficiency %5.2f  difference %.2e' %
+              (threads, wall_time, case['speedup'], case['efficiency'], difference))
+
+        if difference > args.tolerance:
+            sys.stderr.write('%d threads: postprocessors differ from the one-thread run by %g\n' % (threads, difference))
+            failed = True
+
+    with open(args.output, 'w') as f:
+        json.dump(results, f, indent=2, sort_keys=True)
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -21,6 +21,12 @@ public:
 protected:
   std::string _coefficient_format;
   std::vector<std::string> _aux_species;
+  /// Whether EEDF rate coefficients come from one EEDFRateConstantSet
+  bool _fused_eedf_materials;
+  /// Whether the species source terms are integrated by a PointwiseChemistrySplit
+  bool _operator_split;
+  /// Whether the species source terms are NodalKernels with nodal rate coefficients
+  bool _nodal_reactions;
 
 };
 
@@ -20,7 +20,52 @@ public:
   virtual void act();
 
 protected:
+  /// Adds a single ReactionNetworkScalar kernel covering every species and reaction
+  void addNetworkKernel();
+
+  /// Adds an SMP preconditioner coupling exactly the nonzero blocks of the network Jacobian
+  void addNetworkPreconditioner();
+
+  /// Adds a ScalarNetworkEnsemble integrating the cases in ensemble_cases
+  void addEnsemble();
+
+  /// Adds a ReactionRateOfProgress recording the reaction and species rates
+  void addRateOfProgress();
+
+  /**
+   * Picks the quasi-steady-state species (qss_species, and those whose loss
+   * frequency alone makes them shorter-lived than qss_lifetime) and the
+   * conserved_species fixed by the conservation laws of the others.
+   */
+  void findAlgebraicSpecies();
+
+  /// Adds the time derivatives of the ODE species and the conservation constraints
+  void addAlgebraicKernels();
+
+  /// Removes the stoichiometry entries of the species fixed by conservation laws
+  void removeConservedRows(std::vector<unsigned int> & stoich_offsets,
+                           std::vector<unsigned int> & stoich_species,
+                           std::vector<Real> & stoich_coeff) const;
+
+  /// Collects the equation-based reactions and their rate expressions
+  void getEquationReactions(std::vector<unsigned int> & reactions,
+                            std::vector<std::string> & equations) const;
+
   std::vector<std::string> _aux_species;
+  bool _fused_network;
+  bool _sparse_preconditioning;
+
+  /// Index of each reaction in the batched Arrhenius rate set (-1 if not batched)
+  std::vector<int> _arrhenius_index;
+  /// The rate equations handled by the ArrheniusRateProvider
+  std::vector<std::string> _arrhenius_equations;
+
+  /// Whether each species is solved for steady state (without a time derivative)
+  std::vector<bool> _qss;
+  /// The conservation law that determines each species (-1 if none)
+  std::vector<int> _conservation_law;
+  /// Coefficients (indexed by species) of each conservation law in use
+  std::vector<std::vector<Real>> _conservation_coeff;
 
 
 };
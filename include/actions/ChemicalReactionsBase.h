@@ -4,7 +4,10 @@
 #include "AddVariableAction.h"
 #include "Action.h"
 
+#include <memory>
+
 class ChemicalReactionsBase;
+class ReactionMechanism;
 
 template <>
 InputParameters validParams<ChemicalReactionsBase>();
@@ -18,6 +21,80 @@ public:
   virtual void act();
 
 protected:
+  /**
+   * The mechanism of the reactions (parameter text parsed once per process)
+   * or reactions_file, or read from (and compiled into) the mechanism_file
+   * when one is given.
+   */
+  std::shared_ptr<const ReactionMechanism> getMechanism() const;
+
+  /// Parses the reactions parameter or the reactions_file
+  std::shared_ptr<const ReactionMechanism> parseReactions() const;
+
+  /**
+   * Reduces the mechanism with DRG/DRGEP from the states in reduction_states,
+   * keeping the reactions whose participants are all important to the
+   * reduction_targets. Participants that are not species are always kept.
+   */
+  std::shared_ptr<const ReactionMechanism> reduceMechanism(const ReactionMechanism & mechanism) const;
+
+  /// Hash of the mechanism, species, reduction parameters and reduction_states
+  std::uint64_t reductionHash(const ReactionMechanism & mechanism) const;
+
+  /// The input reactions kept by the reduction (the expensive part of reduceMechanism)
+  std::vector<bool> retainedReactions(const ReactionMechanism & mechanism) const;
+
+  /// Fills the reaction data below from a mechanism and the species of this block
+  void loadMechanism(const ReactionMechanism & mechanism);
+
+  /**
+   * Adds a PointwiseChemistrySplit integrating the whole mechanism at the
+   * mesh nodes, for actions that leave the species source terms out of the
+   * transport solve.
+   */
+  void addChemistrySplit(const std::vector<std::string> & aux_species, Real n_gas);
+
+  /// Adds the AuxKernels computing each rate coefficient into its (nodal) aux variable
+  void addNodalRateCoefficients();
+
+  /// Adds a ReactionNodal for every species (except aux_species) changed by each reaction
+  void addNodalReactionKernels(const std::vector<std::string> & aux_species, Real n_gas);
+
+  /// Adds the aux variable holding the lumped mass of each node
+  void addLumpedMassVariable();
+
+  /// Adds the NodalLumpedMass computing it over the blocks of this action
+  void addLumpedMass();
+
+  /// The name of the lumped mass aux variable of this action
+  std::string lumpedMassName() const { return "lumped_mass_" + name(); }
+
+  /// EEDF reactions collected for a single EEDFRateConstantSet
+  struct EEDFRateSet
+  {
+    std::vector<std::string> reactions;
+    std::vector<FileName> files;
+    std::vector<bool> elastic;
+    std::vector<int> target;
+    std::vector<bool> target_aux;
+    std::vector<VariableName> target_species;
+    std::vector<unsigned int> electron;
+    std::vector<VariableName> electrons;
+  };
+
+  /**
+   * Appends EEDF reaction i to set. target_species is its tracked target
+   * (empty for the background gas) and target_aux whether the target is an
+   * aux species.
+   */
+  void addToEEDFRateSet(EEDFRateSet & set,
+                        unsigned int i,
+                        const std::string & target_species,
+                        bool target_aux) const;
+
+  /// Parameters of the EEDFRateConstantSet of set, except for its sampler or mean_en and block
+  InputParameters eedfRateSetParams(const EEDFRateSet & set) const;
+
   const std::vector<NonlinearVariableName> _species;
   const std::vector<NonlinearVariableName> _electron_energy;
   const std::vector<NonlinearVariableName> _gas_energy;
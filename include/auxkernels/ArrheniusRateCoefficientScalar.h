@@ -0,0 +1,41 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef ARRHENIUSRATECOEFFICIENTSCALAR_H
+#define ARRHENIUSRATECOEFFICIENTSCALAR_H
+
+#include "AuxScalarKernel.h"
+#include "ArrheniusRateProvider.h"
+
+class ArrheniusRateCoefficientScalar;
+
+template <>
+InputParameters validParams<ArrheniusRateCoefficientScalar>();
+
+/**
+ * Copies one rate coefficient out of an ArrheniusRateProvider.
+ */
+class ArrheniusRateCoefficientScalar : public AuxScalarKernel
+{
+public:
+  ArrheniusRateCoefficientScalar(const InputParameters & parameters);
+
+protected:
+  virtual Real computeValue();
+
+  const ArrheniusRateProvider & _data;
+  unsigned int _rate_index;
+};
+
+#endif // ARRHENIUSRATECOEFFICIENTSCALAR_H
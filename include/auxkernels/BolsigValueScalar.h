@@ -17,7 +17,7 @@
 
 #include "AuxScalarKernel.h"
 #include "SplineInterpolation.h"
-#include "BoltzmannSolverScalar.h"
+#include "BoltzmannSolverBase.h"
 
 class BolsigValueScalar;
 
@@ -32,7 +32,7 @@ public:
 protected:
   virtual Real computeValue();
 
-  const BoltzmannSolverScalar & _data;
+  const BoltzmannSolverBase & _data;
   std::string _data_type;
   bool _sample_value;
   const VariableValue & _sampler_var;
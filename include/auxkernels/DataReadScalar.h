@@ -16,7 +16,7 @@
 #define DATAREADSCALAR_H
 
 #include "AuxScalarKernel.h"
-#include "SplineInterpolation.h"
+#include "LookupTableRegistry.h"
 #include "LinearInterpolation.h"
 
 class DataReadScalar;
@@ -31,7 +31,7 @@ public:
 
 protected:
   virtual Real computeValue();
-  SplineInterpolation _coefficient_interpolation;
+  std::shared_ptr<const LookupTable> _coefficient_interpolation;
   // LinearInterpolation _coefficient_interpolation_linear;
   const VariableValue & _sampler_var;
   Real _sampler_const;
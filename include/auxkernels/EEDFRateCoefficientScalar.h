@@ -17,7 +17,7 @@
 
 #include "AuxScalarKernel.h"
 #include "SplineInterpolation.h"
-#include "BoltzmannSolverScalar.h"
+#include "BoltzmannSolverBase.h"
 
 class EEDFRateCoefficientScalar;
 
@@ -32,7 +32,7 @@ public:
 protected:
   virtual Real computeValue();
 
-  const BoltzmannSolverScalar & _data;
+  const BoltzmannSolverBase & _data;
   int _reaction_number;
   bool _sample_value;
   const VariableValue & _sampler_var;
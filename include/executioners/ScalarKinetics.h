@@ -0,0 +1,61 @@
+#ifndef SCALARKINETICS_H
+#define SCALARKINETICS_H
+
+#include "Executioner.h"
+
+class ScalarKinetics;
+class NonlinearSystemBase;
+class ScalarKineticsTimeIntegrator;
+
+template <>
+InputParameters validParams<ScalarKinetics>();
+
+/**
+ * Executioner for 0D (pure scalar variable) problems such as global plasma
+ * models built by the ScalarNetwork action. Instead of a Transient solve with
+ * a PETSc nonlinear solve per step, the whole system is integrated with a
+ * variable-order, variable-step BDF method (StiffBDFIntegrator) with local
+ * error control. The residual and Jacobian still come from the kernels of
+ * the problem, and the Jacobian is factored as a dense matrix.
+ *
+ * Every accepted step runs the TIMESTEP_BEGIN and TIMESTEP_END objects and
+ * outputs, so postprocessors, CSV and Exodus output work as with Transient.
+ */
+class ScalarKinetics : public Executioner
+{
+public:
+  ScalarKinetics(const InputParameters & parameters);
+
+  virtual void init() override;
+  virtual void execute() override;
+  virtual bool lastSolveConverged() const override { return _last_solve_converged; }
+
+protected:
+  /// Copies y into the nonlinear solution and updates the system
+  void setSolution(const std::vector<Real> & y);
+
+  void computeResidual(Real t, const std::vector<Real> & y, const std::vector<Real> & ydot, std::vector<Real> & residual);
+  void computeJacobian(Real t, const std::vector<Real> & y, const std::vector<Real> & ydot, Real alpha, std::vector<Real> & jacobian);
+
+  NonlinearSystemBase & _nl;
+  ScalarKineticsTimeIntegrator * _integrator;
+
+  Real & _time;
+  Real & _time_old;
+  int & _t_step;
+  Real & _dt;
+
+  Real _start_time;
+  Real _end_time;
+  Real _initial_dt;
+  Real _dtmin;
+  Real _dtmax;
+  Real _relative_tolerance;
+  Real _absolute_tolerance;
+  unsigned int _max_order;
+  unsigned int _num_steps;
+
+  bool _last_solve_converged;
+};
+
+#endif // SCALARKINETICS_H
@@ -48,5 +48,15 @@ protected:
   bool _w_eq_u;
   bool _v_coupled;
   bool _w_coupled;
+
+  /// exp(value) at the current qp, read from the SpeciesDensity material if given
+  Real density(const VariableValue & value, const MaterialProperty<Real> * density) const
+  {
+    return density ? (*density)[_qp] : std::exp(value[_qp]);
+  }
+
+  /// Densities of the variables (null unless species_density is set)
+  const MaterialProperty<Real> * _v_density;
+  const MaterialProperty<Real> * _w_density;
 };
 #endif // PRODUCTSECONDORDERLOG_H
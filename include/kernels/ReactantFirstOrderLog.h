@@ -40,5 +40,13 @@ protected:
   // const MaterialProperty<Real> & _n_gas;
   Real _stoichiometric_coeff;
 
+  /// exp(value) at the current qp, read from the SpeciesDensity material if given
+  Real density(const VariableValue & value, const MaterialProperty<Real> * density) const
+  {
+    return density ? (*density)[_qp] : std::exp(value[_qp]);
+  }
+
+  /// Densities of the variables (null unless species_density is set)
+  const MaterialProperty<Real> * _u_density;
 };
 #endif // REACTANTFIRSTORDERLOG_H
@@ -42,5 +42,14 @@ protected:
   Real _stoichiometric_coeff;
   bool _v_eq_u;
 
+  /// exp(value) at the current qp, read from the SpeciesDensity material if given
+  Real density(const VariableValue & value, const MaterialProperty<Real> * density) const
+  {
+    return density ? (*density)[_qp] : std::exp(value[_qp]);
+  }
+
+  /// Densities of the variables (null unless species_density is set)
+  const MaterialProperty<Real> * _u_density;
+  const MaterialProperty<Real> * _v_density;
 };
 #endif // REACTANTSECONDORDERLOG_H
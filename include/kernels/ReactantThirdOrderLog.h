@@ -47,5 +47,15 @@ protected:
   const MaterialProperty<Real> & _n_gas;
   Real _stoichiometric_coeff;
 
+  /// exp(value) at the current qp, read from the SpeciesDensity material if given
+  Real density(const VariableValue & value, const MaterialProperty<Real> * density) const
+  {
+    return density ? (*density)[_qp] : std::exp(value[_qp]);
+  }
+
+  /// Densities of the variables (null unless species_density is set)
+  const MaterialProperty<Real> * _u_density;
+  const MaterialProperty<Real> * _v_density;
+  const MaterialProperty<Real> * _w_density;
 };
 #endif // REACTANTTHIRDORDERLOG_H
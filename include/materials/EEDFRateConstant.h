@@ -16,7 +16,7 @@
 
 #include "Material.h"
 /* #include "LinearInterpolation.h" */
-#include "SplineInterpolation.h"
+#include "LookupTableRegistry.h"
 
 class EEDFRateConstant;
 
@@ -31,7 +31,7 @@ public:
 protected:
   virtual void computeQpProperties();
 
-  SplineInterpolation _coefficient_interpolation;
+  std::shared_ptr<const LookupTable> _coefficient_interpolation;
 
   Real _r_units;
   bool _elastic;
@@ -0,0 +1,84 @@
+/****************************************************************/
+/*                      DO NOT MODIFY THIS HEADER               */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*              (c) 2010 Battelle Energy Alliance, LLC          */
+/*                      ALL RIGHTS RESERVED                     */
+/*                                                              */
+/*              Prepared by Battelle Energy Alliance, LLC       */
+/*              Under Contract No. DE-AC07-05ID14517            */
+/*              With the U. S. Department of Energy             */
+/*                                                              */
+/*              See COPYRIGHT for full restrictions             */
+/****************************************************************/
+#ifndef EEDFRATECONSTANTSET_H_
+#define EEDFRATECONSTANTSET_H_
+
+#include "Material.h"
+#include "LookupTableRegistry.h"
+#include "LookupTableSet.h"
+
+class EEDFRateConstantSet;
+
+template <>
+InputParameters validParams<EEDFRateConstantSet>();
+
+/**
+ * Computes the tabulated rate (or Townsend) coefficients of a group of
+ * electron-impact reactions at once. Tables sharing an abscissa are sampled
+ * with a single interval search per quadrature point. Declares the same
+ * properties as one EEDFRateConstant, ZapdosEEDFRateConstant or
+ * EEDFRateConstantTownsend per reaction. Each reaction keeps its own electron
+ * reactant (reaction_electron), which sets the mean energy it is sampled at.
+ */
+class EEDFRateConstantSet : public Material
+{
+public:
+  EEDFRateConstantSet(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpProperties();
+
+  /// Tables grouped by abscissa and electron, and the reaction of each of their columns
+  std::vector<LookupTableSet> _table_sets;
+  std::vector<std::vector<unsigned int>> _set_reactions;
+  /// Index into em of the electron each set is sampled with
+  std::vector<unsigned int> _set_electron;
+
+  unsigned int _num_reactions;
+  bool _townsend;
+  std::vector<bool> _elastic_collision;
+  /// Index of each reaction's target in target_species (-1 for the background gas)
+  std::vector<int> _reaction_target;
+  std::vector<bool> _is_target_aux;
+  /// Index of each reaction's electron reactant in em
+  std::vector<unsigned int> _reaction_electron;
+
+  std::vector<MaterialProperty<Real> *> _reaction_rate;
+  std::vector<MaterialProperty<Real> *> _d_k_d_en;
+  std::vector<MaterialProperty<Real> *> _energy_elastic;
+  std::vector<MaterialProperty<Real> *> _townsend_coefficient;
+  std::vector<MaterialProperty<Real> *> _d_alpha_d_en;
+  std::vector<MaterialProperty<unsigned int> *> _d_alpha_d_var_id;
+  std::vector<MaterialProperty<bool> *> _target_coupled;
+
+  std::vector<const MaterialProperty<Real> *> _mass_incident;
+  std::vector<const MaterialProperty<Real> *> _mass_target;
+  const MaterialProperty<Real> * _n_gas;
+
+  std::vector<const VariableValue *> _target_species;
+  std::vector<unsigned int> _target_id;
+  const bool _sampler_coupled;
+  const bool _mean_en_coupled;
+  const VariableValue & _sampler;
+  std::vector<const VariableValue *> _em;
+  const VariableValue & _mean_en;
+
+  /// Scratch for the sampled values and derivatives of one table set (each thread has its own material)
+  std::vector<Real> _values;
+  std::vector<Real> _derivatives;
+  /// Mean energy of each electron species at the current point
+  std::vector<Real> _mean_energy;
+};
+
+#endif // EEDFRATECONSTANTSET_H_
@@ -16,7 +16,7 @@
 
 #include "Material.h"
 /* #include "LinearInterpolation.h" */
-#include "SplineInterpolation.h"
+#include "LookupTableRegistry.h"
 
 class EEDFRateConstantTownsend;
 
@@ -31,7 +31,7 @@ public:
 protected:
   virtual void computeQpProperties();
 
-  SplineInterpolation _coefficient_interpolation;
+  std::shared_ptr<const LookupTable> _coefficient_interpolation;
 
   Real _r_units;
   std::string _coefficient_format;
@@ -47,6 +47,7 @@ protected:
   const MaterialProperty<Real> & _massIncident;
   const MaterialProperty<Real> & _massTarget;
 
+  const bool _target_species_coupled;
   const VariableValue & _target_species;
   // MooseVariable & _ip_var;
   unsigned int _target_id;
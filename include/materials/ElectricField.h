@@ -15,7 +15,7 @@
 #define ELECTRICFIELD_H_
 
 #include "Material.h"
-#include "SplineInterpolation.h"
+#include "LookupTableRegistry.h"
 
 class ElectricField;
 
@@ -31,7 +31,7 @@ protected:
   virtual void initQpStatefulProperties() override;
   virtual void computeQpProperties() override;
 
-  SplineInterpolation _mobility;
+  std::shared_ptr<const LookupTable> _mobility;
 
   MaterialProperty<Real> & _reduced_field;
   const MaterialProperty<Real> & _voltage;
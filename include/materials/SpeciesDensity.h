@@ -0,0 +1,44 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef SPECIESDENSITY_H_
+#define SPECIESDENSITY_H_
+
+#include "Material.h"
+
+class SpeciesDensity;
+
+template <>
+InputParameters validParams<SpeciesDensity>();
+
+/**
+ * Declares the density exp(u) of each log-form species as the material
+ * property density_<species>, so that it is computed once per quadrature
+ * point for all of the reaction kernels acting on it.
+ */
+class SpeciesDensity : public Material
+{
+public:
+  SpeciesDensity(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpProperties();
+
+private:
+  std::vector<const VariableValue *> _vals;
+  std::vector<MaterialProperty<Real> *> _density;
+};
+
+#endif // SPECIESDENSITY_H_
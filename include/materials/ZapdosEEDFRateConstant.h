@@ -16,7 +16,7 @@
 
 #include "Material.h"
 /* #include "LinearInterpolation.h" */
-#include "SplineInterpolation.h"
+#include "LookupTableRegistry.h"
 
 class ZapdosEEDFRateConstant;
 
@@ -31,7 +31,7 @@ public:
 protected:
   virtual void computeQpProperties();
 
-  SplineInterpolation _coefficient_interpolation;
+  std::shared_ptr<const LookupTable> _coefficient_interpolation;
 
   Real _r_units;
   bool _elastic;
@@ -43,6 +43,7 @@ protected:
   const MaterialProperty<Real> & _massIncident;
   const MaterialProperty<Real> & _massTarget;
   // const MaterialProperty<Real> & _reduced_field;
+  const bool _sampler_coupled;
   const VariableValue & _sampler;
   const VariableValue & _em;
   const VariableValue & _mean_en;
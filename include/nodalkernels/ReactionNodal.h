@@ -0,0 +1,62 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef REACTIONNODAL_H
+#define REACTIONNODAL_H
+
+#include "NodalKernel.h"
+
+// Forward Declaration
+class ReactionNodal;
+
+template <>
+InputParameters validParams<ReactionNodal>();
+
+/**
+ * Source term of one reaction in the equation of one species, evaluated once
+ * per node (lumped mass) instead of at every quadrature point:
+ *
+ *   -coefficient * k * prod(reactant densities) * m,
+ *
+ * where k is a nodal (first order Lagrange) rate coefficient variable,
+ * untracked reactants contribute n_gas each and m is the lumped mass of the
+ * node (NodalLumpedMass), which weights the source like the integrated
+ * kernels of the equation. Covers reactants (negative coefficient) and
+ * products of any order, in linear or logarithmic form.
+ */
+class ReactionNodal : public NodalKernel
+{
+public:
+  ReactionNodal(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpResidual() override;
+  virtual Real computeQpJacobian() override;
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+
+  /// Derivative of the rate of progress with respect to variable var
+  Real rateDerivative(unsigned int var) const;
+
+  const VariableValue & _rate_coefficient;
+  const VariableValue & _lumped_mass;
+  std::vector<const VariableValue *> _reactants;
+  std::vector<unsigned int> _reactant_var;
+  unsigned int _num_reactants;
+  Real _background;
+  Real _stoichiometric_coeff;
+  bool _use_log;
+};
+
+#endif // REACTIONNODAL_H
@@ -0,0 +1,32 @@
+#ifndef BOLTZMANNRATESTALENESS_H
+#define BOLTZMANNRATESTALENESS_H
+
+// MOOSE includes
+#include "GeneralPostprocessor.h"
+
+// Forward Declarations
+class BoltzmannRateStaleness;
+class BoltzmannSolverBase;
+
+template <>
+InputParameters validParams<BoltzmannRateStaleness>();
+
+/**
+ * Reports how old the state is that the EEDF rates used in the current time
+ * step were computed from, in simulation time or in time steps.
+ */
+class BoltzmannRateStaleness : public GeneralPostprocessor
+{
+public:
+  BoltzmannRateStaleness(const InputParameters & parameters);
+
+  virtual void initialize() override {};
+  virtual void execute() override {};
+  virtual Real getValue() override;
+
+protected:
+  const BoltzmannSolverBase & _data;
+  const MooseEnum & _measure;
+};
+
+#endif // BOLTZMANNRATESTALENESS_H
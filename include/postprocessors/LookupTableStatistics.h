@@ -0,0 +1,30 @@
+#ifndef LOOKUPTABLESTATISTICS_H
+#define LOOKUPTABLESTATISTICS_H
+
+// MOOSE includes
+#include "GeneralPostprocessor.h"
+
+// Forward Declarations
+class LookupTableStatistics;
+
+template <>
+InputParameters validParams<LookupTableStatistics>();
+
+/**
+ * Reports the number of tables or the memory held by the shared
+ * LookupTableRegistry on this process.
+ */
+class LookupTableStatistics : public GeneralPostprocessor
+{
+public:
+  LookupTableStatistics(const InputParameters & parameters);
+
+  virtual void initialize() override {};
+  virtual void execute() override {};
+  virtual Real getValue() override;
+
+protected:
+  const MooseEnum & _statistic;
+};
+
+#endif // LOOKUPTABLESTATISTICS_H
@@ -0,0 +1,41 @@
+#ifndef CONSERVATIONCONSTRAINTSCALAR_H
+#define CONSERVATIONCONSTRAINTSCALAR_H
+
+#include "ODEKernel.h"
+
+class ConservationConstraintScalar;
+
+template <>
+InputParameters validParams<ConservationConstraintScalar>();
+
+/**
+ * Replaces the rate equation of a species that is fixed by a conservation
+ * law of the network, u + sum_j c_j n_j = const, with the algebraic equation
+ *
+ *   (u - u_old) + sum_j c_j (n_j - n_j_old) = 0,
+ *
+ * so the conserved quantity carries over exactly from step to step. The
+ * variable must not have a time derivative kernel.
+ */
+class ConservationConstraintScalar : public ODEKernel
+{
+public:
+  ConservationConstraintScalar(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpResidual() override;
+  virtual Real computeQpJacobian() override;
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+
+  /// Density of a (log form) variable value
+  Real density(Real value) const { return _use_log ? std::exp(value) : value; }
+
+  unsigned int _num_species;
+  std::vector<const VariableValue *> _species;
+  std::vector<const VariableValue *> _species_old;
+  std::vector<unsigned int> _species_number;
+  std::vector<Real> _coefficients;
+  bool _use_log;
+};
+
+#endif /* CONSERVATIONCONSTRAINTSCALAR_H */
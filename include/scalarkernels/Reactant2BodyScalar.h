@@ -1,34 +1,12 @@
 #ifndef REACTANT2BODYSCALAR_H
 #define REACTANT2BODYSCALAR_H
 
-#include "ODEKernel.h"
-// #include "RateCoefficientProvider.h"
+#include "ScalarReactionKernel.h"
 
-class Reactant2BodyScalar;
+/// Consumption of u by u + v -> ...
+typedef ScalarReactionKernel<2, true, false> Reactant2BodyScalar;
 
 template <>
 InputParameters validParams<Reactant2BodyScalar>();
 
-class Reactant2BodyScalar : public ODEKernel
-{
-public:
-  Reactant2BodyScalar(const InputParameters & parameters);
-
-protected:
-  virtual Real computeQpResidual() override;
-  virtual Real computeQpJacobian() override;
-  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
-
-  int _v_var;
-  const VariableValue & _v;
-  const VariableValue & _rate_coefficient;
-
-  Real _n_gas;
-  Real _stoichiometric_coeff;
-  bool _v_eq_u;
-  bool _rate_constant_equation;
-
-  // const RateCoefficientProvider & _data;
-};
-
 #endif /* REACTANT2BODYSCALAR_H */
@@ -0,0 +1,94 @@
+#ifndef REACTIONNETWORKSCALAR_H
+#define REACTIONNETWORKSCALAR_H
+
+#include "ScalarKernel.h"
+#include "FunctionParserUtils.h"
+#include "ReactionNetwork.h"
+
+class ReactionNetworkScalar;
+class FEProblemBase;
+class MooseVariableScalar;
+class ThreadPool;
+
+template <>
+InputParameters validParams<ReactionNetworkScalar>();
+
+/**
+ * Single ScalarKernel that assembles the source terms of an entire scalar
+ * reaction network. Every reaction rate is computed once per evaluation and
+ * scattered into the residual (and Jacobian) of each participating species.
+ * Replaces the per-(species, reaction) Product*BodyScalar/Reactant*BodyScalar
+ * kernels added by the ScalarNetwork action.
+ *
+ * The Jacobian is assembled only over the sparsity pattern derived from the
+ * stoichiometry. Rate equations that depend on nonlinear equation_variables
+ * are evaluated here (rather than read from their AuxVariable) so that their
+ * derivatives can be included in the Jacobian.
+ *
+ * With num_threads > 1 the densities, rates, source terms and Jacobian are
+ * computed on a ThreadPool. The results do not depend on the thread count.
+ */
+class ReactionNetworkScalar : public ScalarKernel, public FunctionParserUtils
+{
+public:
+  ReactionNetworkScalar(const InputParameters & parameters);
+
+  virtual void reinit() override {}
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+
+  const ReactionNetwork & network() const { return _network; }
+
+protected:
+  /// Copies the current species densities (exp(u) in log form) into _density
+  void updateDensities();
+
+  /// Gathers the current rate coefficients into _rate_values
+  void updateRateCoefficients();
+
+  /// Evaluates d(k_r)/d(x_c) for every rate equation dependency
+  void updateRateDerivatives();
+
+  /// Loads the current equation variable values into the parser buffer
+  void updateEquationVariables();
+
+  FEProblemBase & _fe_problem;
+
+  ReactionNetwork _network;
+
+  unsigned int _num_species;
+  unsigned int _num_reactions;
+  std::vector<MooseVariableScalar *> _species_var;
+  std::vector<const VariableValue *> _species_value;
+  /// Whether each species is a nonlinear variable (has a residual row)
+  std::vector<bool> _is_nonlinear;
+  std::vector<const VariableValue *> _rate_coefficient;
+
+  unsigned int _num_equation_variables;
+  std::vector<const VariableValue *> _equation_value;
+  /// Variables of the Jacobian columns past the species (nonlinear equation_variables)
+  std::vector<MooseVariableScalar *> _column_var;
+
+  /// Parsed rate equation of each reaction that depends on a nonlinear variable (else null)
+  std::vector<ADFunctionPtr> _rate_function;
+  /// Parsed derivative of each rate equation dependency
+  std::vector<ADFunctionPtr> _rate_derivative_function;
+
+  Real _n_gas;
+  bool _use_log;
+
+  /// Threads sharing the network evaluation (null to evaluate serially)
+  std::shared_ptr<ThreadPool> _pool;
+  /// Per-reaction Jacobian contributions of the threaded evaluation
+  std::vector<Real> _jacobian_work;
+
+  std::vector<Real> _density;
+  std::vector<Real> _rate_values;
+  std::vector<Real> _rates;
+  std::vector<Real> _source;
+  std::vector<Real> _rate_derivative;
+  std::vector<Real> _jacobian;
+};
+
+#endif // REACTIONNETWORKSCALAR_H
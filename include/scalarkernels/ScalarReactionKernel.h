@@ -0,0 +1,67 @@
+#ifndef SCALARREACTIONKERNEL_H
+#define SCALARREACTIONKERNEL_H
+
+#include "ODEKernel.h"
+
+#include <array>
+
+class ScalarDensityProvider;
+
+/**
+ * Rate term -c k n_1 ... n_R of a reaction with num_reactants reactants,
+ * acting on a scalar species u that the reaction consumes (u_reactant, in
+ * which case u is the first reactant) or produces. The other reactants are
+ * the coupled variables v, w and x; a reactant left uncoupled is the
+ * background gas (n_gas), and v_eq_u etc. mark a reactant that is u itself.
+ * In log form the variables hold the logarithm of the densities, n = exp(u).
+ *
+ * The reactant count and the density form are template parameters. Which
+ * reactants are coupled is resolved on construction into packed arrays, so
+ * that the residual and Jacobian are loops over at most num_reactants
+ * densities with no per-call parameter lookups. The registered
+ * Product/Reactant{1,2,3}BodyScalar[Log] kernels are instantiations.
+ */
+template <unsigned int num_reactants, bool u_reactant, bool log_form>
+class ScalarReactionKernel : public ODEKernel
+{
+public:
+  ScalarReactionKernel(const InputParameters & parameters);
+
+  /// The parameters of an instantiation, returned by its validParams
+  static InputParameters kernelParams();
+
+protected:
+  virtual Real computeQpResidual();
+  virtual Real computeQpJacobian();
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar);
+
+  /// Coupled reactants (v, w, x) other than u
+  static const unsigned int num_slots = num_reactants - u_reactant;
+
+  /// Appends a reactant held by a variable
+  void addReactant(const VariableValue & value, unsigned int var_number, const std::string & name);
+
+  /// Density of the m-th reactant held by a variable
+  Real density(unsigned int m) const;
+
+  /// Derivative of the residual with respect to variable jvar
+  Real derivative(unsigned int jvar) const;
+
+  const VariableValue & _rate_coefficient;
+  const Real _stoichiometric_coeff;
+
+  /// Product of n_gas over the uncoupled reactants
+  Real _gas_factor;
+
+  /// Shared densities (log form only; null to compute them here)
+  const ScalarDensityProvider * _density_provider;
+
+  /// Reactants held by variables: values, the variable each differentiates
+  /// against (u for those equal to u) and their index in _density_provider
+  unsigned int _num_coupled;
+  std::array<const VariableValue *, num_reactants> _value;
+  std::array<unsigned int, num_reactants> _wrt;
+  std::array<unsigned int, num_reactants> _index;
+};
+
+#endif /* SCALARREACTIONKERNEL_H */
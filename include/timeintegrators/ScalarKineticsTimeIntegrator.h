@@ -0,0 +1,36 @@
+#ifndef SCALARKINETICSTIMEINTEGRATOR_H
+#define SCALARKINETICSTIMEINTEGRATOR_H
+
+#include "TimeIntegrator.h"
+
+class ScalarKineticsTimeIntegrator;
+
+template <>
+InputParameters validParams<ScalarKineticsTimeIntegrator>();
+
+/**
+ * Time integrator driven by the ScalarKinetics executioner. It holds no
+ * history of its own: the executioner sets the time derivative of every
+ * degree of freedom and d(u_dot)/du from its variable-order BDF formula, and
+ * this object hands them to the kernels when MOOSE evaluates the residual
+ * and Jacobian.
+ */
+class ScalarKineticsTimeIntegrator : public TimeIntegrator
+{
+public:
+  ScalarKineticsTimeIntegrator(const InputParameters & parameters);
+
+  virtual int order() override { return 1; }
+  virtual void computeTimeDerivatives() override;
+  virtual void computeADTimeDerivatives(DualReal & ad_u_dot, const dof_id_type & dof) const override;
+  virtual void postResidual(NumericVector<Number> & residual) override;
+
+  /// Sets u_dot (indexed by global dof) and d(u_dot)/du
+  void setTimeDerivative(const std::vector<Real> & u_dot, Real du_dot_du);
+
+protected:
+  std::vector<Real> _u_dot_values;
+  Real _du_dot_du_value;
+};
+
+#endif // SCALARKINETICSTIMEINTEGRATOR_H
@@ -0,0 +1,73 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef ARRHENIUSRATEPROVIDER_H
+#define ARRHENIUSRATEPROVIDER_H
+
+#include "GeneralUserObject.h"
+#include "ArrheniusRateSet.h"
+
+#include <memory>
+#include <mutex>
+
+// Forward Declarations
+class ArrheniusRateProvider;
+class ThreadPool;
+
+template <>
+InputParameters validParams<ArrheniusRateProvider>();
+
+/**
+ * Evaluates a whole set of modified-Arrhenius rate coefficients,
+ * k = A * x^b * exp(-c/y), in a single pass. The set is re-evaluated lazily
+ * the first time a rate is requested after any of the arguments has changed.
+ * The update is guarded by a mutex, so rates may be requested from any
+ * thread; the arguments are read from the master thread's scalar values.
+ */
+class ArrheniusRateProvider : public GeneralUserObject
+{
+public:
+  ArrheniusRateProvider(const InputParameters & parameters);
+
+  /// The current value of rate coefficient i (in the order of rate_equations)
+  Real rate(unsigned int i) const;
+
+  unsigned int size() const { return _rates.size(); }
+
+  virtual void initialize();
+
+  virtual void execute();
+
+  virtual void finalize();
+
+protected:
+  /// Re-evaluates all rates if the arguments changed since the last call (with _mutex held)
+  void update() const;
+
+  unsigned int _nargs;
+  std::vector<const VariableValue *> _args;
+
+  ArrheniusRateSet _rate_set;
+
+  /// Threads sharing the evaluation (null to evaluate serially)
+  std::shared_ptr<ThreadPool> _pool;
+
+  /// Guards the lazily updated members below
+  mutable std::mutex _mutex;
+  mutable bool _evaluated;
+  mutable std::vector<Real> _arg_values;
+  mutable std::vector<Real> _rates;
+};
+
+#endif // ARRHENIUSRATEPROVIDER_H
@@ -0,0 +1,193 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef BOLTZMANNSOLVERBASE_H
+#define BOLTZMANNSOLVERBASE_H
+
+#include "GeneralUserObject.h"
+#include "LookupTable.h"
+#include "BoltzmannTableCache.h"
+
+#include <deque>
+#include <future>
+#include <map>
+#include <memory>
+
+// Forward Declarations
+class BoltzmannSolverBase;
+
+template <>
+InputParameters validParams<BoltzmannSolverBase>();
+
+/**
+ * Base class of the user objects that compute electron rate coefficients,
+ * mobility and mean energy from the EEDF (BOLSIG+ or the built-in two-term
+ * solver). Decides when to re-solve (n_steps, cutoff_time), collects the gas
+ * state, converts the solver output and provides the sampling interface used
+ * by EEDFRateCoefficientScalar and BolsigValueScalar.
+ *
+ * With asynchronous = true a re-solve runs on a background thread, on a
+ * snapshot of the state, while the time step is solved with the previous
+ * tables; the new tables replace them at the next execution (TIMESTEP_BEGIN).
+ *
+ * A re-solve is skipped unless the state has drifted by more than
+ * drift_tolerance since the last one, and with cache_resolution > 0 the
+ * tables of earlier solves are reused for states in the same quantized bin.
+ * With cache_directory set, tables are also stored on disk under a hash of
+ * the solver configuration (cross sections included) and the state, so that
+ * later runs can load them instead of solving.
+ *
+ * execute() runs on the master thread between MOOSE's threaded loops and is
+ * the only place the step counter and the current tables change. The sampling
+ * methods only read the immutable Results, so they may be called from any
+ * thread.
+ */
+class BoltzmannSolverBase : public GeneralUserObject
+{
+public:
+  BoltzmannSolverBase(const InputParameters & parameters);
+  virtual ~BoltzmannSolverBase();
+
+  Real test(const int i) const;
+  Real electron_mobility() const;
+  Real electron_temperature() const;
+  Real coefficient_sample(const int i, const Real sampler) const;
+  Real electron_temperature_sample(const Real sampler) const;
+  Real electron_mobility_sample(const Real sampler) const;
+
+  /// Time and time step at which the current tables were last computed or,
+  /// when a solve was skipped because the state had not drifted, confirmed
+  Real resultsTime() const;
+  int resultsTimeStep() const;
+
+  virtual void initialize() override {}
+
+  virtual void execute() override;
+
+  virtual void finalize() override {}
+
+protected:
+  /// Gas conditions the EEDF is computed for
+  struct State
+  {
+    std::vector<Real> mole_fractions;
+    /// E/N (V m^2)
+    Real reduced_field;
+    Real neutral_density;
+    Real ionization_fraction;
+    Real time;
+    int t_step;
+  };
+
+  /**
+   * Solver output in SI units: rate coefficients (m^3/s), reduced mobility
+   * mu*N (1/(m V s)) and mean energy (eV), one entry per table point (a single
+   * entry if output_table = false).
+   */
+  struct Tables
+  {
+    std::vector<Real> x;
+    std::vector<std::vector<Real>> rate_coefficient;
+    std::vector<Real> mobility;
+    std::vector<Real> temperature;
+  };
+
+  /// Computes the tables for the given state
+  virtual void solve(const State & state, Tables & tables) = 0;
+
+  /// Hash of everything besides the state that the tables depend on (cross sections, solver settings)
+  virtual std::uint64_t configurationHash() const = 0;
+
+  /// The current values of the coupled variables
+  State currentState() const;
+
+  /// Waits for a background solve; derived classes call this in their destructor
+  void waitForPendingSolve();
+
+  /// Converted results and their interpolations
+  struct Results
+  {
+    Real time;
+    int t_step;
+    std::vector<std::vector<Real>> rate_coefficient;
+    std::vector<Real> electron_mobility;
+    std::vector<Real> electron_temperature;
+    std::vector<LookupTable> coefficient_interpolation;
+    std::vector<LookupTable> temperature_interpolation;
+    std::vector<LookupTable> mobility_interpolation;
+  };
+
+  /// Converts solver output to the units requested
+  std::shared_ptr<const Results> makeResults(const State & state, const Tables & tables) const;
+
+  typedef std::vector<long long> CacheKey;
+
+  /// |value - reference| relative to max(|reference|, floor)
+  static Real relativeChange(const Real value, const Real reference, const Real floor);
+
+  /// Whether the state has moved far enough from the last solve to re-solve
+  bool drifted(const State & state) const;
+
+  /// The quantized state the tables are cached under
+  CacheKey cacheKey(const State & state) const;
+
+  /// Caches the tables (also on disk if persist = true) and makes them current
+  void storeTables(const State & state, const std::shared_ptr<const Tables> & tables, bool persist = true);
+
+  /// Key of the tables in the on-disk cache
+  std::uint64_t diskCacheKey(const State & state);
+
+  std::size_t _nargs;
+  std::vector<const VariableValue *> _args;
+  const VariableValue & _reduced_field;
+  const VariableValue & _plasma_density;
+  const VariableValue & _ionization_fraction;
+  std::vector<std::string> _reaction_species;
+  std::vector<std::string> _reaction_type;
+  bool _output_table;
+  std::string _table_variable;
+  std::vector<int> _reaction_number;
+  int _num_reactions;
+  int _n_steps;
+  Real _cutoff_time;
+  Real _conversion_factor;
+  unsigned int _timestep_number;
+  bool _asynchronous;
+
+  std::shared_ptr<const Results> _results;
+
+  Real _drift_tolerance;
+  Real _mole_fraction_floor;
+  Real _cache_resolution;
+  unsigned int _cache_size;
+
+  /// State of the last solve (or cache hit), for the drift check
+  State _solved_state;
+  bool _has_solved_state;
+
+  std::map<CacheKey, std::shared_ptr<const Tables>> _cache;
+  /// Cached keys, oldest first
+  std::deque<CacheKey> _cache_order;
+
+  /// On-disk cache (cache_directory), and configurationHash() once computed
+  std::unique_ptr<BoltzmannTableCache> _disk_cache;
+  std::uint64_t _configuration_hash;
+  bool _has_configuration_hash;
+
+  /// Background solve started at the last execution (asynchronous = true)
+  std::future<std::shared_ptr<const Tables>> _pending;
+  State _pending_state;
+};
+
+#endif /* BOLTZMANNSOLVERBASE_H */
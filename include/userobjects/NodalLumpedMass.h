@@ -0,0 +1,54 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef NODALLUMPEDMASS_H
+#define NODALLUMPEDMASS_H
+
+#include "ElementUserObject.h"
+
+#include <unordered_map>
+
+// Forward Declarations
+class NodalLumpedMass;
+
+template <>
+InputParameters validParams<NodalLumpedMass>();
+
+/**
+ * Fills a first order Lagrange aux variable with the lumped (row-sum) mass
+ * of each node, the integral of its test function over the elements of the
+ * blocks of this object. Nodal source terms (ReactionNodal) are multiplied
+ * by it so that they are weighted like the integrated kernels of the same
+ * equation. Computed once on INITIAL, so the mesh must not change.
+ */
+class NodalLumpedMass : public ElementUserObject
+{
+public:
+  NodalLumpedMass(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+
+protected:
+  MooseVariable & _mass_var;
+  const VariablePhiValue & _phi;
+
+  /// Mass of each dof of _mass_var from the elements of this thread
+  std::unordered_map<dof_id_type, Real> _mass;
+};
+
+#endif // NODALLUMPEDMASS_H
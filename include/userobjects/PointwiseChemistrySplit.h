@@ -0,0 +1,104 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef POINTWISECHEMISTRYSPLIT_H
+#define POINTWISECHEMISTRYSPLIT_H
+
+#include "GeneralUserObject.h"
+#include "ReactionNetwork.h"
+#include "ArrheniusRateSet.h"
+#include "LookupTable.h"
+
+#include "libmesh/numeric_vector.h"
+
+#include <memory>
+#include <set>
+
+// Forward Declarations
+class PointwiseChemistrySplit;
+class NonlinearSystemBase;
+
+template <>
+InputParameters validParams<PointwiseChemistrySplit>();
+
+/**
+ * Strang operator splitting of the reaction source terms of a spatial
+ * (nodal, Lagrange) problem. Instead of assembling the chemistry into the
+ * global residual, the species densities at each local mesh node are
+ * advanced as an independent 0D problem with StiffBDFIntegrator over half a
+ * time step before the transport solve (TIMESTEP_BEGIN) and again after it
+ * (TIMESTEP_END). The nodes are integrated concurrently on num_threads
+ * threads.
+ *
+ * Rate coefficients are frozen over each half step at their nodal values:
+ * constants, modified-Arrhenius equations of the equation variables, and
+ * EEDF tables sampled at the sampler variable.
+ *
+ * The first half step is written into the old solution for the transport
+ * solve only. The old solution from before it is kept, so that a retried
+ * step starts again from that state, and it is put back once the step has
+ * converged (the step history and checkpoints never see the split state).
+ * Only nodes in block (all nodes if empty) at which every non-fixed species
+ * has a degree of freedom take part.
+ */
+class PointwiseChemistrySplit : public GeneralUserObject
+{
+public:
+  PointwiseChemistrySplit(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+protected:
+  /// Value of variable var at a node (0 if the variable has no dof there)
+  Real nodalValue(MooseVariable & var, const Node & node) const;
+
+  /// The local nodes integrated by the split
+  void findNodes(std::vector<const Node *> & nodes) const;
+
+  NonlinearSystemBase & _nl;
+
+  ReactionNetwork _network;
+  unsigned int _num_species;
+  unsigned int _num_reactions;
+  unsigned int _num_equation_variables;
+  std::vector<MooseVariable *> _species_var;
+  std::vector<MooseVariable *> _equation_var;
+  MooseVariable * _sampler_var;
+  std::vector<bool> _fixed;
+  /// The subdomains of the split (all if empty)
+  std::set<SubdomainID> _blocks;
+
+  std::vector<Real> _rate_constants;
+  /// The Arrhenius set evaluated at every node, and the reaction of each of its terms
+  ArrheniusRateSet _rate_set;
+  std::vector<unsigned int> _equation_reactions;
+  /// EEDF tables, and the reaction each of them belongs to
+  std::vector<std::shared_ptr<const LookupTable>> _tables;
+  std::vector<unsigned int> _table_reactions;
+
+  const Real _n_gas;
+  const bool _use_log;
+  const Real _relative_tolerance;
+  const Real _absolute_tolerance;
+  unsigned int _num_threads;
+
+  /// The old solution before the first half step, and the step it belongs to
+  std::unique_ptr<NumericVector<Number>> _split_old;
+  int _split_step;
+};
+
+#endif /* POINTWISECHEMISTRYSPLIT_H */
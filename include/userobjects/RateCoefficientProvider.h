@@ -16,7 +16,7 @@
 #define RATECOEFFICIENTPROVIDER_H
 
 #include "GeneralUserObject.h"
-#include "SplineInterpolation.h"
+#include "LookupTableRegistry.h"
 
 // Forward Declarations
 class RateCoefficientProvider;
@@ -25,12 +25,22 @@ class RateCoefficientProvider;
 template <>
 InputParameters validParams<RateCoefficientProvider>();
 
+/**
+ * Provides the rate coefficient of a reaction: a constant or a value sampled
+ * from a shared (immutable) EEDF table. Nothing changes after construction,
+ * so the methods taking the reduced field may be called from any thread;
+ * reaction_coefficient() reads the coupled reduced field, which is only
+ * current on the master thread.
+ */
 class RateCoefficientProvider : public GeneralUserObject
 {
 public:
   RateCoefficientProvider(const InputParameters & parameters);
 
+  /// The rate coefficient at the coupled reduced field
   Real reaction_coefficient() const;
+  /// The rate coefficient at the given reduced field (V m^2)
+  Real reaction_coefficient(const Real reduced_field) const;
   Real reaction_coefficient_derivative() const;
   Real electron_temperature(const Real E_N) const;
   // Real reduced_field(const Real reduced_field_old, const Real gas_density) const;
@@ -42,11 +52,19 @@ public:
   virtual void finalize();
 
 protected:
-  SplineInterpolation _coefficient_interpolation;
+  /// Source of the rate coefficient, resolved from rate_format on construction
+  enum RateFormat
+  {
+    CONSTANT,
+    EEDF,
+    EQUATION
+  };
+
+  std::shared_ptr<const LookupTable> _coefficient_interpolation;
   Real _rate_constant;
 
   std::string _sampling_format;
-  std::string _rate_format;
+  RateFormat _rate_format;
   const VariableValue & _reduced_field_value;
   // Function & _function;
   // const Point & _point;
@@ -0,0 +1,72 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef SCALARDENSITYPROVIDER_H
+#define SCALARDENSITYPROVIDER_H
+
+#include "GeneralUserObject.h"
+
+// Forward Declarations
+class ScalarDensityProvider;
+
+template <>
+InputParameters validParams<ScalarDensityProvider>();
+
+/**
+ * Shares the densities exp(u) of log-form scalar species between the
+ * reaction kernels. Each exponential is recomputed only when the value of
+ * its species has changed since it was last requested, so it is evaluated
+ * once per species and residual (or Jacobian) evaluation rather than once
+ * per kernel and derivative.
+ *
+ * The cache is written from the const density() without any locking, so it
+ * relies on MOOSE evaluating scalar kernels serially on the main thread. It
+ * must not be used from objects that run on several threads at once (field
+ * kernels, or ThreadPool tasks such as those of the fused network).
+ */
+class ScalarDensityProvider : public GeneralUserObject
+{
+public:
+  ScalarDensityProvider(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual void finalize() override {}
+
+  /// Position of the named species in the species list
+  unsigned int index(const std::string & name) const;
+
+  /// exp(u) of the species at the given position
+  Real density(unsigned int species) const
+  {
+    const Real u = (*_value[species])[0];
+    if (u != _log_density[species])
+    {
+      _log_density[species] = u;
+      _density[species] = std::exp(u);
+    }
+    return _density[species];
+  }
+
+protected:
+  std::vector<std::string> _names;
+  std::vector<const VariableValue *> _value;
+
+  /// The values the cached densities were computed from (NaN until first use)
+  mutable std::vector<Real> _log_density;
+  mutable std::vector<Real> _density;
+};
+
+#endif /* SCALARDENSITYPROVIDER_H */
@@ -0,0 +1,81 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef SCALARNETWORKENSEMBLE_H
+#define SCALARNETWORKENSEMBLE_H
+
+#include "GeneralUserObject.h"
+#include "ArrheniusRateSet.h"
+#include "ReactionNetwork.h"
+
+// Forward Declarations
+class ScalarNetworkEnsemble;
+
+template <>
+InputParameters validParams<ScalarNetworkEnsemble>();
+
+/**
+ * Runs a sweep of independent 0D cases of the ScalarNetwork mechanism inside
+ * one process. Each row of the cases file overrides the initial densities
+ * and/or equation variables (e.g. Tg, Te) of the deck; the mechanism is
+ * parsed once, rate coefficients of all cases are filled in one batched
+ * pass, and the cases are integrated with StiffBDFIntegrator spread over
+ * MPI ranks (round robin) and threads. Case k is written to
+ * <file_base>_case<k>.csv.
+ *
+ * Only constant and modified-Arrhenius rate coefficients are supported (any
+ * other rate equation is rejected on construction), and equation variables
+ * are held at their case values (no energy equations).
+ */
+class ScalarNetworkEnsemble : public GeneralUserObject
+{
+public:
+  ScalarNetworkEnsemble(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+protected:
+  /// Writes the densities of case c at the output times
+  void writeCase(unsigned int c, const std::vector<std::vector<Real>> & output) const;
+
+  ReactionNetwork _network;
+  unsigned int _num_species;
+  unsigned int _num_reactions;
+  unsigned int _num_equation_variables;
+  std::vector<std::string> _species_names;
+  std::vector<std::string> _equation_variable_names;
+  std::vector<const VariableValue *> _species_value;
+  std::vector<const VariableValue *> _equation_value;
+  std::vector<bool> _fixed;
+
+  std::vector<Real> _rate_constants;
+  std::vector<std::string> _rate_equations;
+
+  /// The rate equations, parsed on construction, and the reactions they belong to
+  ArrheniusRateSet _rate_set;
+  std::vector<unsigned int> _equation_reactions;
+
+  const Real _n_gas;
+  const bool _use_log;
+  const std::vector<Real> _output_times;
+  const std::string _file_base;
+  const Real _relative_tolerance;
+  const Real _absolute_tolerance;
+  const Real _initial_dt;
+  unsigned int _num_threads;
+};
+
+#endif /* SCALARNETWORKENSEMBLE_H */
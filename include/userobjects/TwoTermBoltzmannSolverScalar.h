@@ -0,0 +1,59 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef TWOTERMBOLTZMANNSOLVERSCALAR_H
+#define TWOTERMBOLTZMANNSOLVERSCALAR_H
+
+#include "BoltzmannSolverBase.h"
+#include "TwoTermBoltzmann.h"
+
+// Forward Declarations
+class TwoTermBoltzmannSolverScalar;
+
+template <>
+InputParameters validParams<TwoTermBoltzmannSolverScalar>();
+
+/**
+ * Drop-in replacement for BoltzmannSolverScalar that solves the two-term
+ * Boltzmann equation in-process (see TwoTermBoltzmann) from LXCat cross
+ * sections instead of running BOLSIG+. Each solve starts its growth-rate
+ * iteration from the previous solve's growth rate; the EEDF itself is
+ * recomputed directly. Electron-electron collisions are neglected, so
+ * ionization_fraction does not affect the results.
+ */
+class TwoTermBoltzmannSolverScalar : public BoltzmannSolverBase
+{
+public:
+  TwoTermBoltzmannSolverScalar(const InputParameters & parameters);
+  virtual ~TwoTermBoltzmannSolverScalar();
+
+protected:
+  virtual void solve(const State & state, Tables & tables) override;
+  virtual std::uint64_t configurationHash() const override;
+
+  /// Stores the current solution as entry j of the tables
+  void storeSolution(Tables & tables, unsigned int j, Real x) const;
+
+  LXCatCrossSections _cross_sections;
+  TwoTermBoltzmann _solver;
+  Real _gas_temperature;
+
+  /// Index of each reaction's process in the cross section set
+  std::vector<unsigned int> _collision;
+
+  /// E/N values (Td) the table is computed at
+  std::vector<Real> _table_field;
+};
+
+#endif /* TWOTERMBOLTZMANNSOLVERSCALAR_H */
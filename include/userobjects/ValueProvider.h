@@ -16,7 +16,7 @@
 #define ValueProvider_H
 
 #include "GeneralUserObject.h"
-#include "SplineInterpolation.h"
+#include "LookupTableRegistry.h"
 
 // Forward Declarations
 class ValueProvider;
@@ -25,6 +25,10 @@ class ValueProvider;
 template <>
 InputParameters validParams<ValueProvider>();
 
+/**
+ * Samples the electron temperature from a shared (immutable) table. Nothing
+ * changes after construction, so it may be called from any thread.
+ */
 class ValueProvider : public GeneralUserObject
 {
 public:
@@ -39,11 +43,9 @@ public:
   virtual void finalize();
 
 protected:
-  SplineInterpolation _coefficient_interpolation;
-  Real _rate_constant;
+  std::shared_ptr<const LookupTable> _coefficient_interpolation;
 
   std::string _sampling_format;
-  std::string _rate_format;
 };
 
 #endif /* ValueProvider_H */
@@ -0,0 +1,117 @@
+#ifndef ARRHENIUSRATESET_H
+#define ARRHENIUSRATESET_H
+
+#include "MooseTypes.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+class ThreadPool;
+
+/**
+ * A set of modified-Arrhenius rate coefficients,
+ *
+ *   k = A * x^b * exp(-c / y),
+ *
+ * stored as structure-of-arrays so that all of them are evaluated in one
+ * branch-free loop. x and y are (possibly different) variables, referred to by
+ * their position in the argument list.
+ *
+ * x^b is computed as exp(b ln x), which is only defined for x > 0; if any
+ * argument is not positive the set is evaluated with std::pow instead, as the
+ * rate equations would be by FParser. The logarithms and reciprocals of the
+ * arguments go to scratch buffers of the set, so one set must not be
+ * evaluated from several threads at once (the pooled evaluate() splits a
+ * single evaluation over threads).
+ */
+class ArrheniusRateSet
+{
+public:
+  /// Parameters of a single recognized rate expression
+  struct Term
+  {
+    Real A = 1.0;
+    Real b = 0.0;
+    Real c = 0.0;
+    /// Index of the power-law variable in the argument list (-1 if none)
+    int x = -1;
+    /// Index of the exponential variable in the argument list (-1 if none)
+    int y = -1;
+  };
+
+  ArrheniusRateSet() = default;
+
+  /**
+   * Tries to recognize a rate expression as modified-Arrhenius. Accepted
+   * factors (joined by '*') are numbers, X, X^b, (X)^(b), (N/X)^b, (X/N)^b,
+   * N/X^b, X^b/N and exp(+-N/Y), where X and Y are either variables or
+   * numeric constants. '^' binds tighter than '/', as in FParser.
+   * @return false if the expression does not match, in which case it must be
+   *         evaluated with FParser instead
+   */
+  static bool parse(const std::string & expression,
+                    const std::vector<std::string> & variables,
+                    const std::map<std::string, Real> & constants,
+                    Term & term);
+
+  /**
+   * Collects the equation constants whose expressions are plain numbers.
+   * Constants given as FParser expressions are left out, so any rate
+   * equation using them falls back to FParser.
+   */
+  static std::map<std::string, Real> numericConstants(const std::vector<std::string> & names,
+                                                      const std::vector<std::string> & expressions);
+
+  /// Appends a rate coefficient, returning its index in the set
+  unsigned int add(const Term & term);
+
+  unsigned int size() const { return _A.size(); }
+  unsigned int numArgs() const { return _num_args; }
+
+  /// Sets the number of variables referred to by the terms
+  void setNumArgs(unsigned int num_args)
+  {
+    _num_args = num_args;
+    _log_args.resize(_num_args + 1);
+    _inv_args.resize(_num_args + 1);
+  }
+
+  /**
+   * Evaluates every rate coefficient.
+   * @param args Current value of each variable
+   * @param rates Output, one entry per term
+   */
+  void evaluate(const Real * args, Real * rates) const;
+
+  /// evaluate() split over blocks of terms
+  void evaluate(const Real * args, Real * rates, ThreadPool & pool) const;
+
+protected:
+  /**
+   * Fills ln(arg) and 1/arg (num_args + 1 entries each, slot 0 fixed to zero).
+   * @return false if an argument is not positive
+   */
+  bool prepareArgs(const Real * args, Real * log_args, Real * inv_args) const;
+
+  /// Evaluates terms [begin, end) from the prepared arguments
+  void evaluateRange(const Real * log_args, const Real * inv_args, Real * rates, unsigned int begin, unsigned int end) const;
+
+  /// Evaluates terms [begin, end) with std::pow, for arguments that are not all positive
+  void evaluatePow(const Real * args, const Real * inv_args, Real * rates, unsigned int begin, unsigned int end) const;
+
+  unsigned int _num_args = 0;
+
+  std::vector<Real> _A;
+  std::vector<Real> _b;
+  std::vector<Real> _c;
+  /// Argument slot of the power-law and exponential variables (0 = none)
+  std::vector<unsigned int> _x;
+  std::vector<unsigned int> _y;
+
+  /// ln(arg) and 1/arg of the current evaluation (slot 0 fixed to zero)
+  mutable std::vector<Real> _log_args = std::vector<Real>(1);
+  mutable std::vector<Real> _inv_args = std::vector<Real>(1);
+};
+
+#endif // ARRHENIUSRATESET_H
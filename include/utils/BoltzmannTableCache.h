@@ -0,0 +1,54 @@
+#ifndef BOLTZMANNTABLECACHE_H
+#define BOLTZMANNTABLECACHE_H
+
+#include "MooseTypes.h"
+
+#include <cstdint>
+#include <set>
+#include <string>
+#include <vector>
+
+/**
+ * Directory of Boltzmann solver tables (abscissa, rate coefficients, reduced
+ * mobility and mean energy) stored in a flat binary format, one file per
+ * 64-bit key. Files are written to a temporary name and renamed, so runs
+ * sharing the directory never see a partial file, and read back with mmap.
+ */
+class BoltzmannTableCache
+{
+public:
+  BoltzmannTableCache(const std::string & directory);
+
+  /// 64-bit FNV-1a hash of bytes, continuing from seed
+  static std::uint64_t hash(const void * data, std::size_t bytes, std::uint64_t seed = 14695981039346656037ULL);
+  static std::uint64_t hashString(const std::string & s, std::uint64_t seed = 14695981039346656037ULL);
+
+  /**
+   * Hash of the contents of a file.
+   * @param skip_lines Line numbers (from 1) that are left out of the hash
+   */
+  static std::uint64_t hashFile(const std::string & file_name, const std::set<unsigned int> & skip_lines = {});
+
+  /// Reads the tables stored under key; returns false if there are none
+  bool load(std::uint64_t key,
+            std::vector<Real> & x,
+            std::vector<std::vector<Real>> & rate_coefficient,
+            std::vector<Real> & mobility,
+            std::vector<Real> & temperature) const;
+
+  /// Stores the tables under key
+  void store(std::uint64_t key,
+             const std::vector<Real> & x,
+             const std::vector<std::vector<Real>> & rate_coefficient,
+             const std::vector<Real> & mobility,
+             const std::vector<Real> & temperature) const;
+
+  const std::string & directory() const { return _directory; }
+
+protected:
+  std::string fileName(std::uint64_t key) const;
+
+  std::string _directory;
+};
+
+#endif // BOLTZMANNTABLECACHE_H
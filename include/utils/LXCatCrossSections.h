@@ -0,0 +1,66 @@
+#ifndef LXCATCROSSSECTIONS_H
+#define LXCATCROSSSECTIONS_H
+
+#include "MooseTypes.h"
+
+#include <string>
+#include <vector>
+
+/**
+ * Electron-neutral cross sections read from an LXCat (BOLSIG+) formatted
+ * file. Each process block starts with one of the keywords ELASTIC, EFFECTIVE,
+ * EXCITATION, IONIZATION or ATTACHMENT and ends with an energy (eV) vs. cross
+ * section (m^2) table enclosed in dashed lines.
+ */
+class LXCatCrossSections
+{
+public:
+  enum class Kind
+  {
+    ELASTIC,
+    EFFECTIVE,
+    EXCITATION,
+    IONIZATION,
+    ATTACHMENT
+  };
+
+  struct Collision
+  {
+    Kind kind;
+    /// Target species (left-hand side of the process)
+    std::string target;
+    /// Process description, e.g. "N2 -> N2(A3)"
+    std::string process;
+    /// Threshold energy (eV), zero for elastic and attachment processes
+    Real threshold = 0.0;
+    /// Electron to target mass ratio (elastic and effective processes only)
+    Real mass_ratio = 0.0;
+    std::vector<Real> energy;
+    std::vector<Real> cross_section;
+
+    /// Cross section at energy u; zero below the table, constant above it
+    Real sample(Real u) const;
+  };
+
+  /// Reads every process in file_name
+  static LXCatCrossSections fromFile(const std::string & file_name);
+
+  const std::vector<Collision> & collisions() const { return _collisions; }
+
+  /// Name of a process kind as used by BOLSIG+ ("Elastic", "Ionization", ...)
+  static std::string kindName(Kind kind);
+
+  /**
+   * Finds the process of target matching a BOLSIG+ style identifier such as
+   * "Ionization 15.60 eV": the process kind must match and, if the identifier
+   * contains a number, the threshold must agree with it to within 1%.
+   * The identifier may instead be the process description ("N2 -> N2(A3)").
+   * @return the index of the process, or -1 if none matches
+   */
+  int find(const std::string & target, const std::string & identifier) const;
+
+protected:
+  std::vector<Collision> _collisions;
+};
+
+#endif // LXCATCROSSSECTIONS_H
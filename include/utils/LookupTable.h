@@ -0,0 +1,83 @@
+#ifndef LOOKUPTABLE_H
+#define LOOKUPTABLE_H
+
+#include "MooseTypes.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * Immutable two-column interpolation table (e.g. rate coefficient vs. reduced
+ * field) read from a text file, interpolated with a natural cubic spline.
+ * Tables are normally obtained from the LookupTableRegistry so that every
+ * object sampling the same file shares one copy.
+ *
+ * On construction the abscissa is classified as uniform, log-uniform or
+ * irregular. Uniform and log-uniform tables locate the sampling interval by
+ * direct index computation; irregular tables use a binary search. Both give
+ * the same interval (and therefore the same result) as SplineInterpolation.
+ */
+class LookupTable
+{
+public:
+  /// Spacing of the table abscissa
+  enum class Grid
+  {
+    IRREGULAR,
+    UNIFORM,
+    LOG_UNIFORM
+  };
+
+  /**
+   * Builds the table from abscissa/ordinate pairs.
+   * @param sort Whether to sort the pairs by abscissa first
+   */
+  LookupTable(const std::vector<Real> & x, const std::vector<Real> & y, bool sort = false);
+
+  /**
+   * Reads whitespace-separated "x y" pairs from a file.
+   * @param sort Whether to sort the pairs by abscissa first
+   */
+  static LookupTable fromFile(const std::string & file_name, bool sort = false);
+
+  /// Spline interpolation of the table at x
+  Real sample(Real x) const;
+
+  /// Derivative of the spline interpolation at x
+  Real sampleDerivative(Real x) const;
+
+  unsigned int size() const { return _x.size(); }
+  Grid grid() const { return _grid; }
+
+  const std::vector<Real> & x() const { return _x; }
+  const std::vector<Real> & y() const { return _y; }
+  const std::vector<Real> & secondDerivatives() const { return _y2; }
+
+  /// Approximate memory held by the table
+  std::size_t bytes() const;
+
+  /// Index of the interval [x_k, x_k+1] used to sample x (clamped to the table)
+  unsigned int findInterval(Real x) const;
+
+protected:
+  /// Computes the natural spline second derivatives
+  void computeSecondDerivatives();
+
+  /// Classifies the abscissa spacing
+  void detectGrid();
+
+  /// Binary search, identical to SplineInterpolation
+  unsigned int bisect(Real x) const;
+
+  std::vector<Real> _x;
+  std::vector<Real> _y;
+  std::vector<Real> _y2;
+
+  Grid _grid;
+  /// Origin and inverse spacing of the (log-)uniform grid
+  Real _origin;
+  Real _inv_spacing;
+};
+
+#endif // LOOKUPTABLE_H
@@ -0,0 +1,54 @@
+#ifndef LOOKUPTABLEREGISTRY_H
+#define LOOKUPTABLEREGISTRY_H
+
+#include "LookupTable.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+/**
+ * Process-wide cache of LookupTables keyed by canonical file path. Each file
+ * is parsed once and the resulting (immutable) table is shared by every
+ * AuxKernel, Material and UserObject that samples it, regardless of how many
+ * blocks or threads instantiate those objects.
+ *
+ * Each table is stored with the modification time and size of its file, so
+ * a file rewritten during the run (e.g. a BOLSIG+ output table) is read again
+ * rather than served from the cache.
+ */
+class LookupTableRegistry
+{
+public:
+  static LookupTableRegistry & instance();
+
+  /**
+   * Returns the table stored in file_name, reading it on first use or when
+   * the file has changed since it was read.
+   * @param sort Whether the pairs should be sorted by abscissa (cached separately)
+   */
+  std::shared_ptr<const LookupTable> get(const std::string & file_name, bool sort = false);
+
+  /// Number of distinct tables held
+  unsigned int numTables() const;
+
+  /// Approximate memory held by all tables
+  std::size_t bytes() const;
+
+protected:
+  LookupTableRegistry() = default;
+
+  struct Entry
+  {
+    /// Modification time (ns) and size of the file the table was read from
+    long long mtime;
+    long long size;
+    std::shared_ptr<const LookupTable> table;
+  };
+
+  mutable std::mutex _mutex;
+  std::map<std::string, Entry> _tables;
+};
+
+#endif // LOOKUPTABLEREGISTRY_H
@@ -0,0 +1,45 @@
+#ifndef LOOKUPTABLESET_H
+#define LOOKUPTABLESET_H
+
+#include "LookupTable.h"
+
+#include <memory>
+#include <vector>
+
+/**
+ * Several LookupTables that share one abscissa (e.g. the rate coefficients of
+ * every electron-impact reaction tabulated against mean energy). The
+ * ordinates and spline second derivatives are stored interleaved by knot, so
+ * that a single interval search yields every column and each interval
+ * touches contiguous memory.
+ */
+class LookupTableSet
+{
+public:
+  /// Builds the set; every table must have exactly the same abscissa
+  LookupTableSet(const std::vector<std::shared_ptr<const LookupTable>> & tables);
+
+  /// Whether two tables can be stored in the same set
+  static bool sameAbscissa(const LookupTable & a, const LookupTable & b);
+
+  /**
+   * Samples every column at x with one interval search.
+   * @param values Output, one spline value per column
+   * @param derivatives Output, one spline derivative per column
+   */
+  void sample(Real x, Real * values, Real * derivatives) const;
+
+  unsigned int numColumns() const { return _num_columns; }
+
+protected:
+  /// Table used to locate intervals (its abscissa is shared by all columns)
+  std::shared_ptr<const LookupTable> _abscissa;
+
+  unsigned int _num_columns;
+
+  /// Ordinates and second derivatives, indexed [knot * _num_columns + column]
+  std::vector<Real> _y;
+  std::vector<Real> _y2;
+};
+
+#endif // LOOKUPTABLESET_H
@@ -0,0 +1,91 @@
+#ifndef MECHANISMREDUCTION_H
+#define MECHANISMREDUCTION_H
+
+#include "ReactionNetwork.h"
+
+#include <vector>
+
+class ReactionMechanism;
+
+/**
+ * Directed-relation-graph reduction of a ReactionMechanism from sampled
+ * states. Every participant is a graph node, and the edge A -> B weighs the
+ * error that removing B would make in the net production rate of A:
+ *
+ *   DRG:   r_AB = sum_r |nu_Ar w_r| delta_Br / sum_r |nu_Ar w_r|
+ *   DRGEP: r_AB = |sum_r nu_Ar w_r delta_Br| / max(P_A, C_A)
+ *
+ * with w_r the rate of progress of reaction r, delta_Br = 1 if B takes part in
+ * r and P_A, C_A the production and consumption rates of A. The importance of
+ * a participant is the strongest path to it from the target species (the
+ * weakest edge of the path for DRG, the product of its edges for DRGEP),
+ * maximized over the states.
+ */
+class MechanismReduction
+{
+public:
+  enum class Method
+  {
+    DRG,
+    DRGEP
+  };
+
+  /// The mechanism must outlive the reduction
+  MechanismReduction(const ReactionMechanism & mechanism);
+
+  /**
+   * Adds a sampled state.
+   * @param density Density of every participant (indexed as in names())
+   * @param rate_coefficient Rate coefficient of every reaction
+   */
+  void addState(const std::vector<Real> & density, const std::vector<Real> & rate_coefficient);
+
+  /**
+   * Integrates a 0D case from the given state to end_time and adds the states
+   * at num_samples logarithmically spaced times (over six decades), as well
+   * as the initial one.
+   * @param fixed Participants whose density is held constant
+   * @return false if the integration stopped early
+   */
+  bool addPilotStates(const std::vector<Real> & density,
+                      const std::vector<Real> & rate_coefficient,
+                      const std::vector<bool> & fixed,
+                      Real end_time,
+                      unsigned int num_samples);
+
+  unsigned int numStates() const { return _rates.size(); }
+
+  /// Importance of every participant (1 for the targets, 0 if unreachable)
+  std::vector<Real> importance(const std::vector<unsigned int> & targets, Method method) const;
+
+  /// Which input reactions have all their participants kept
+  std::vector<bool> retainedReactions(const std::vector<bool> & keep) const;
+
+protected:
+  /// Interaction coefficients of every edge in one state
+  void interactionCoefficients(const std::vector<Real> & rates, Method method, std::vector<Real> & coefficient) const;
+
+  const ReactionMechanism & _mechanism;
+  unsigned int _num_participants;
+
+  /// Every participant is a species of the network, with no background slots
+  ReactionNetwork _network;
+
+  /// Edges A -> B in CSR form over A
+  std::vector<unsigned int> _edge_offsets;
+  std::vector<unsigned int> _edge_targets;
+
+  /// Each (edge, reaction) term of the numerators: the edge, its reaction and nu_Ar
+  struct Contribution
+  {
+    unsigned int edge;
+    unsigned int reaction;
+    Real coeff;
+  };
+  std::vector<Contribution> _contributions;
+
+  /// Rates of progress of every reaction in each state
+  std::vector<std::vector<Real>> _rates;
+};
+
+#endif // MECHANISMREDUCTION_H
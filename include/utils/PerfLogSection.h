@@ -0,0 +1,37 @@
+#ifndef PERFLOGSECTION_H
+#define PERFLOGSECTION_H
+
+#include "Moose.h"
+
+#include "libmesh/threads.h"
+
+/**
+ * Times the enclosing scope as the given event of the "Crane" header of
+ * Moose::perf_log, which is printed with the performance summary at the end
+ * of a run. The log is not thread safe, so scopes entered from threaded
+ * loops are not timed.
+ */
+class PerfLogSection
+{
+public:
+  PerfLogSection(const char * label) : _label(label), _active(!libMesh::Threads::in_threads)
+  {
+    if (_active)
+      Moose::perf_log.push(_label, "Crane");
+  }
+
+  ~PerfLogSection()
+  {
+    if (_active)
+      Moose::perf_log.pop(_label, "Crane");
+  }
+
+  PerfLogSection(const PerfLogSection &) = delete;
+  PerfLogSection & operator=(const PerfLogSection &) = delete;
+
+private:
+  const char * _label;
+  const bool _active;
+};
+
+#endif // PERFLOGSECTION_H
@@ -0,0 +1,75 @@
+#ifndef REACTIONENSEMBLE_H
+#define REACTIONENSEMBLE_H
+
+#include "ReactionNetwork.h"
+
+#include <functional>
+#include <vector>
+
+/**
+ * Many independent 0D cases of one reaction mechanism. The mechanism is held
+ * once; densities and rate coefficients of all cases are stored as
+ * structure-of-arrays ([species][case], [reaction][case]) so that case
+ * parameters can be swept and rate coefficients filled in one pass per
+ * reaction. Each case is integrated on its own with StiffBDFIntegrator, so
+ * cases can be handed to different threads.
+ */
+class ReactionEnsemble
+{
+public:
+  /// The network must have its sparsity built over exactly its species
+  ReactionEnsemble(const ReactionNetwork & network, Real background_density);
+
+  void setNumCases(unsigned int num_cases);
+  unsigned int numCases() const { return _num_cases; }
+
+  /// Species whose density is held constant (e.g. AuxVariable species)
+  void setFixedSpecies(const std::vector<bool> & fixed);
+
+  Real & density(unsigned int species, unsigned int c) { return _density[species * _num_cases + c]; }
+  Real & rateCoefficient(unsigned int reaction, unsigned int c) { return _rate_coefficient[reaction * _num_cases + c]; }
+
+  /**
+   * Integrates case c through the output times, leaving its final densities
+   * in place. Distinct cases may be integrated concurrently.
+   * @param output Densities at each output time, [time][species]
+   * @return false if the integration failed (step size underflow)
+   */
+  bool integrate(unsigned int c,
+                 const std::vector<Real> & output_times,
+                 Real relative_tolerance,
+                 Real absolute_tolerance,
+                 Real initial_dt,
+                 std::vector<std::vector<Real>> & output);
+
+  /// Called with each case and its output once the case has been integrated
+  typedef std::function<void(unsigned int c, const std::vector<std::vector<Real>> & output)> CaseCallback;
+
+  /**
+   * Integrates the given cases on num_threads threads, each pulling the next
+   * case when done with one. Exceptions thrown on a worker thread are
+   * rethrown here.
+   * @param done Called on the worker thread after each case (may be empty)
+   * @return The number of cases whose integration failed
+   */
+  unsigned int integrateCases(const std::vector<unsigned int> & cases,
+                              const std::vector<Real> & output_times,
+                              Real relative_tolerance,
+                              Real absolute_tolerance,
+                              Real initial_dt,
+                              unsigned int num_threads,
+                              const CaseCallback & done = CaseCallback());
+
+protected:
+  const ReactionNetwork & _network;
+  Real _background_density;
+  unsigned int _num_species;
+  unsigned int _num_reactions;
+  unsigned int _num_cases;
+  std::vector<bool> _fixed;
+
+  std::vector<Real> _density;
+  std::vector<Real> _rate_coefficient;
+};
+
+#endif // REACTIONENSEMBLE_H
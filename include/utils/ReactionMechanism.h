@@ -0,0 +1,171 @@
+#ifndef REACTIONMECHANISM_H
+#define REACTIONMECHANISM_H
+
+#include "MooseTypes.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * The species-independent part of a reaction mechanism, as parsed from the
+ * "reactions" text of the ChemicalReactions actions. Participant names are
+ * interned (sorted, unique) and reactions refer to them by index through CSR
+ * reactant and product arrays. Reversible reactions are followed by their
+ * generated superelastic counterparts, as in ChemicalReactionsBase.
+ *
+ * A mechanism can be written to and read from a compact binary file, so that
+ * large mechanisms are parsed once rather than at the start of every run.
+ *
+ * Mechanisms can also be read, one line at a time, from reaction files in
+ * Crane (one reaction per line, as in the reactions parameter), ZDPlasKin
+ * (kinet.inp: "reaction ! rate", Bolsig+ processes as EEDF reactions) or
+ * CHEMKIN-like (modified-Arrhenius "reaction A b E") syntax. Crane and
+ * ZDPlasKin terms must be separated by spaces; CHEMKIN reactions may also be
+ * written without them and with stoichiometric prefixes ("H2+O2=2OH"), and
+ * their pre-exponential factors are converted from per mole (the MOLES
+ * default) to per molecule, keeping the length unit of the file. CHEMKIN
+ * "=" and "<=>" reactions are reversible; only "=>" is irreversible.
+ */
+class ReactionMechanism
+{
+public:
+  enum RateType : unsigned char
+  {
+    CONSTANT = 0,
+    EQUATION = 1,
+    EEDF = 2,
+    /// Generated superelastic reaction (rate from its forward reaction)
+    SUPERELASTIC = 3
+  };
+
+  enum Flag : unsigned char
+  {
+    ENERGY_CHANGE = 1,
+    ELASTIC = 2,
+    REVERSIBLE = 4,
+    IDENTIFIED = 8
+  };
+
+  enum class Format
+  {
+    CRANE,
+    ZDPLASKIN,
+    CHEMKIN
+  };
+
+  ReactionMechanism() = default;
+
+  /// Parses the reactions text (one reaction per line)
+  static ReactionMechanism parse(const std::string & text);
+
+  /**
+   * Parses a reactions file line by line.
+   * @param temperature Variable the CHEMKIN Arrhenius rates are written in
+   */
+  static ReactionMechanism parseFile(const std::string & file_name, Format format, const std::string & temperature = "Tgas");
+
+  /**
+   * Returns the parsed mechanism of the text, parsing it only the first time
+   * a given text is seen in this process.
+   */
+  static std::shared_ptr<const ReactionMechanism> parseCached(const std::string & text);
+
+  /// 64-bit hash identifying the reactions text a mechanism was parsed from
+  static std::uint64_t sourceHash(const std::string & text, std::uint64_t seed = 14695981039346656037ULL);
+
+  /**
+   * Reads a mechanism file written by write().
+   * @return false if the file does not exist or is not a mechanism file
+   */
+  bool read(const std::string & file_name);
+
+  /// Writes the mechanism to file_name (through a temporary file and a rename)
+  void write(const std::string & file_name) const;
+
+  /**
+   * The mechanism made of the input reactions flagged in keep (and the
+   * superelastic counterparts of the reversible ones among them).
+   */
+  ReactionMechanism subset(const std::vector<bool> & keep) const;
+
+  /// The input reactions in the syntax of the reactions parameter, one per line
+  std::string text() const;
+
+  unsigned int numReactions() const { return _label.size(); }
+  /// Number of reactions in the text (the superelastic ones follow them)
+  unsigned int numInputReactions() const { return _num_input_reactions; }
+
+  /// Sorted, unique participant names
+  const std::vector<std::string> & names() const { return _names; }
+  /// Index of name in names(), or names().size() if it does not take part
+  unsigned int id(const std::string & name) const;
+
+  const std::string & label(unsigned int r) const { return _label[r]; }
+  RateType rateType(unsigned int r) const { return static_cast<RateType>(_rate_type[r]); }
+  bool hasFlag(unsigned int r, Flag flag) const { return _flags[r] & flag; }
+  Real rateCoefficient(unsigned int r) const { return _rate_coefficient[r]; }
+  Real thresholdEnergy(unsigned int r) const { return _threshold_energy[r]; }
+  /// Rate equation of reaction r ("NONE" if it has none)
+  const std::string & rateEquation(unsigned int r) const { return _rate_equation[r]; }
+  /// Identifier of reaction r (empty unless IDENTIFIED)
+  const std::string & identifier(unsigned int r) const { return _identifier[r]; }
+  /// Forward reaction of a superelastic reaction
+  unsigned int forwardReaction(unsigned int r) const { return _forward[r]; }
+
+  const std::vector<unsigned int> & reactantOffsets() const { return _reactant_offsets; }
+  const std::vector<unsigned int> & reactantIds() const { return _reactant_ids; }
+  const std::vector<unsigned int> & productOffsets() const { return _product_offsets; }
+  const std::vector<unsigned int> & productIds() const { return _product_ids; }
+
+  /// The source hash given to write(), as read back by read()
+  std::uint64_t storedSourceHash() const { return _source_hash; }
+  void setSourceHash(std::uint64_t hash) { _source_hash = hash; }
+
+protected:
+  /// Parsers of a single reaction line; where prefixes error messages
+  void parseCraneLine(const std::string & line, const std::string & where);
+  void parseZDPlasKinLine(const std::string & line, const std::string & where);
+  void parseChemkinLine(const std::string & line,
+                        const std::string & where,
+                        const std::string & temperature,
+                        Real energy_to_kelvin,
+                        bool per_mole);
+
+  /// Appends a reaction written as "A + B -> C + D", interning its participants
+  void addReaction(const std::string & label,
+                   unsigned char type,
+                   unsigned char flags,
+                   Real coefficient,
+                   Real threshold,
+                   const std::string & equation,
+                   const std::string & identifier);
+
+  /// Adds the superelastic reactions and numbers the participants in name order
+  void finalize();
+
+  unsigned int _num_input_reactions = 0;
+  std::uint64_t _source_hash = 0;
+
+  std::vector<std::string> _names;
+  /// Index of each name in _names while parsing
+  std::unordered_map<std::string, unsigned int> _intern;
+
+  std::vector<std::string> _label;
+  std::vector<unsigned char> _rate_type;
+  std::vector<unsigned char> _flags;
+  std::vector<Real> _rate_coefficient;
+  std::vector<Real> _threshold_energy;
+  std::vector<std::string> _rate_equation;
+  std::vector<std::string> _identifier;
+  std::vector<unsigned int> _forward;
+
+  std::vector<unsigned int> _reactant_offsets = {0};
+  std::vector<unsigned int> _reactant_ids;
+  std::vector<unsigned int> _product_offsets = {0};
+  std::vector<unsigned int> _product_ids;
+};
+
+#endif // REACTIONMECHANISM_H
@@ -0,0 +1,223 @@
+#ifndef REACTIONNETWORK_H
+#define REACTIONNETWORK_H
+
+#include "MooseTypes.h"
+
+#include <string>
+#include <vector>
+
+class ThreadPool;
+
+/**
+ * Compact (CSR) representation of a reaction mechanism.
+ *
+ * Each reaction stores its reactant slots (species index, or -1 for the
+ * untracked background gas) and its net stoichiometric changes. All reaction
+ * rates are computed in a single sweep and then scattered into the species
+ * source terms, so a mechanism with R reactions costs O(R) per evaluation
+ * instead of O(R * S) separate kernel calls.
+ *
+ * The evaluations can also be split across the threads of a ThreadPool. The
+ * rates are independent per reaction. The source terms and Jacobian entries
+ * are gathered from per-reaction contributions in reaction order, so that the
+ * threaded results are identical to the serial ones for any thread count.
+ */
+class ReactionNetwork
+{
+public:
+  ReactionNetwork() = default;
+
+  /**
+   * Sets the reactant slots of every reaction.
+   * @param offsets CSR row offsets (size num_reactions + 1)
+   * @param species Species index of each reactant slot (-1 for background gas)
+   */
+  void setReactants(const std::vector<unsigned int> & offsets, const std::vector<int> & species);
+
+  /**
+   * Sets the net stoichiometric change of every reaction.
+   * @param offsets CSR row offsets (size num_reactions + 1)
+   * @param species Species index of each entry
+   * @param coeff Net stoichiometric coefficient of each entry
+   */
+  void setStoichiometry(const std::vector<unsigned int> & offsets,
+                        const std::vector<unsigned int> & species,
+                        const std::vector<Real> & coeff);
+
+  /**
+   * Sets the additional (non-species) Jacobian columns that each rate
+   * coefficient depends on, e.g. a nonlinear temperature variable appearing in
+   * a rate equation. Column indices start at numSpecies().
+   * @param offsets CSR row offsets (size num_reactions + 1)
+   * @param columns Jacobian column of each dependency
+   */
+  void setRateDependencies(const std::vector<unsigned int> & offsets,
+                           const std::vector<unsigned int> & columns);
+
+  /// Sets the number of species (rows of the source term)
+  void setNumSpecies(unsigned int num_species) { _num_species = num_species; }
+
+  /**
+   * Derives the species-by-column sparsity pattern of the Jacobian from the
+   * stoichiometry and precomputes where every reaction contribution lands in
+   * the packed value array. Must be called after the reactants, stoichiometry
+   * and (optional) rate dependencies have been set.
+   * @param num_columns Total number of Jacobian columns (species + extra)
+   */
+  void buildSparsity(unsigned int num_columns);
+
+  unsigned int numReactions() const { return _num_reactions; }
+  unsigned int numSpecies() const { return _num_species; }
+  unsigned int numColumns() const { return _num_columns; }
+  unsigned int numNonzeros() const { return _jacobian_columns.size(); }
+
+  const std::vector<unsigned int> & reactantOffsets() const { return _reactant_offsets; }
+  const std::vector<int> & reactantSpecies() const { return _reactant_species; }
+  const std::vector<unsigned int> & stoichOffsets() const { return _stoich_offsets; }
+  const std::vector<unsigned int> & stoichSpecies() const { return _stoich_species; }
+  const std::vector<Real> & stoichCoeff() const { return _stoich_coeff; }
+  const std::vector<unsigned int> & rateDependencyOffsets() const { return _rate_dep_offsets; }
+  const std::vector<unsigned int> & rateDependencyColumns() const { return _rate_dep_columns; }
+
+  /// Row offsets of the Jacobian sparsity pattern (size num_species + 1)
+  const std::vector<unsigned int> & jacobianOffsets() const { return _jacobian_offsets; }
+  /// Sorted column indices of each Jacobian row
+  const std::vector<unsigned int> & jacobianColumns() const { return _jacobian_columns; }
+
+  /**
+   * Computes the rate of progress of every reaction,
+   * rate_r = k_r * prod(n_reactants).
+   */
+  void computeRates(const Real * density,
+                    const Real * rate_coefficient,
+                    Real background_density,
+                    Real * rates) const;
+
+  /// Scatters the reaction rates into the species source terms (dn/dt)
+  void computeSource(const Real * rates, Real * source) const;
+
+  /// computeRates() split over blocks of reactions
+  void computeRates(const Real * density,
+                    const Real * rate_coefficient,
+                    Real background_density,
+                    Real * rates,
+                    ThreadPool & pool) const;
+
+  /// computeSource() split over blocks of species (requires buildSparsity())
+  void computeSource(const Real * rates, Real * source, ThreadPool & pool) const;
+
+  /**
+   * Computes the nonzero entries of the Jacobian of the species source terms,
+   * d(source_i)/d(n_j) and d(source_i)/d(x_c) for the rate dependencies,
+   * packed in the order of jacobianColumns().
+   * @param rate_derivative d(k_r)/d(x_c) for each rate dependency (may be
+   *                        nullptr when there are none)
+   */
+  void computeJacobian(const Real * density,
+                       const Real * rate_coefficient,
+                       const Real * rate_derivative,
+                       Real background_density,
+                       Real * jacobian) const;
+
+  /**
+   * computeJacobian() with the contributions of blocks of reactions computed
+   * in parallel into work, then gathered over blocks of nonzeros.
+   */
+  void computeJacobian(const Real * density,
+                       const Real * rate_coefficient,
+                       const Real * rate_derivative,
+                       Real background_density,
+                       Real * jacobian,
+                       std::vector<Real> & work,
+                       ThreadPool & pool) const;
+
+  /**
+   * Finds a basis of the conserved linear combinations sum_j c_j n_j of the
+   * given species (c^T S = 0 over their rows S of the stoichiometric matrix).
+   * Each law has its own dependent species, with coefficient 1, that appears
+   * in no other law.
+   * @param order Species to consider, most independent first: the dependent
+   *              species are taken from the end of the list
+   * @param dependent Output, the dependent species of each law
+   * @param laws Output, the coefficients of each law (indexed by species)
+   */
+  void conservationLaws(const std::vector<unsigned int> & order,
+                        std::vector<unsigned int> & dependent,
+                        std::vector<std::vector<Real>> & laws) const;
+
+  /**
+   * Builds the CSR arrays from the per-reaction reactant names and the
+   * species_count table produced by ChemicalReactionsBase.
+   */
+  static void buildCSR(const std::vector<std::string> & species,
+                       const std::vector<std::vector<std::string>> & reactants,
+                       const std::vector<std::vector<Real>> & species_count,
+                       std::vector<unsigned int> & reactant_offsets,
+                       std::vector<int> & reactant_species,
+                       std::vector<unsigned int> & stoich_offsets,
+                       std::vector<unsigned int> & stoich_species,
+                       std::vector<Real> & stoich_coeff);
+
+  /**
+   * Whether a parsed rate expression refers to the given symbol as a whole
+   * identifier (so "Te" does not match "Teff").
+   */
+  static bool expressionUsesSymbol(const std::string & expression, const std::string & symbol);
+
+protected:
+  /// Position of (row, col) in the packed Jacobian value array
+  unsigned int jacobianIndex(unsigned int row, unsigned int col) const;
+
+  /// Rates of progress of reactions [begin, end)
+  void computeRates(const Real * density,
+                    const Real * rate_coefficient,
+                    Real background_density,
+                    Real * rates,
+                    unsigned int begin,
+                    unsigned int end) const;
+
+  /// CSR lists of the items 0..n-1 sent to each target (in item order)
+  static void buildGather(const std::vector<unsigned int> & target,
+                          unsigned int num_targets,
+                          std::vector<unsigned int> & offsets,
+                          std::vector<unsigned int> & items);
+
+  /// Derivative of the rate of reaction r with respect to its reactant slot p
+  Real rateDerivative(unsigned int r, unsigned int p, const Real * density, const Real * rate_coefficient, Real background_density) const;
+
+  unsigned int _num_reactions = 0;
+  unsigned int _num_species = 0;
+
+  std::vector<unsigned int> _reactant_offsets;
+  std::vector<int> _reactant_species;
+
+  std::vector<unsigned int> _stoich_offsets;
+  std::vector<unsigned int> _stoich_species;
+  std::vector<Real> _stoich_coeff;
+
+  std::vector<unsigned int> _rate_dep_offsets;
+  std::vector<unsigned int> _rate_dep_columns;
+
+  unsigned int _num_columns = 0;
+  std::vector<unsigned int> _jacobian_offsets;
+  std::vector<unsigned int> _jacobian_columns;
+
+  /// Packed Jacobian position of each (reaction, reactant slot, stoichiometry entry)
+  std::vector<unsigned int> _reactant_scatter;
+  /// Packed Jacobian position of each (reaction, rate dependency, stoichiometry entry)
+  std::vector<unsigned int> _rate_dep_scatter;
+
+  /// Stoichiometry entries of each species (CSR over species, in reaction order)
+  std::vector<unsigned int> _source_offsets;
+  std::vector<unsigned int> _source_entries;
+  /// Reaction of each stoichiometry entry
+  std::vector<unsigned int> _stoich_reaction;
+
+  /// First Jacobian contribution of each reaction, in the order computeJacobian() adds them
+  std::vector<unsigned int> _contribution_offsets;
+  /// Contributions to each packed Jacobian entry (CSR over entries, in order)
+  std::vector<unsigned int> _gather_offsets;
+  std::vector<unsigned int> _gather_contributions;
+};
+
+#endif // REACTIONNETWORK_H
@@ -0,0 +1,121 @@
+#ifndef STIFFBDFINTEGRATOR_H
+#define STIFFBDFINTEGRATOR_H
+
+#include "MooseTypes.h"
+
+#include <deque>
+#include <functional>
+#include <vector>
+
+/**
+ * Variable-order (1-5), variable-step BDF integrator for small, stiff,
+ * implicit systems R(t, y, dy/dt) = 0 such as 0D reaction networks.
+ *
+ * The BDF coefficients are computed from the actual past step times, the
+ * local error is estimated from the difference between the corrector and an
+ * extrapolating predictor, and the step size and order are chosen from that
+ * estimate. Each step is solved with a modified Newton iteration that keeps
+ * the dense LU factorization of the iteration matrix dR/dy + alpha dR/dydot
+ * for as long as it converges.
+ */
+class StiffBDFIntegrator
+{
+public:
+  /// Computes residual = R(t, y, ydot)
+  typedef std::function<void(Real t, const std::vector<Real> & y, const std::vector<Real> & ydot, std::vector<Real> & residual)>
+      Residual;
+
+  /// Computes the dense, row-major iteration matrix dR/dy + alpha dR/dydot
+  typedef std::function<void(Real t,
+                             const std::vector<Real> & y,
+                             const std::vector<Real> & ydot,
+                             Real alpha,
+                             std::vector<Real> & jacobian)>
+      Jacobian;
+
+  StiffBDFIntegrator(unsigned int size, Residual residual, Jacobian jacobian);
+
+  void setTolerances(Real relative, Real absolute);
+  void setMaxOrder(unsigned int order);
+  void setStepLimits(Real minimum, Real maximum);
+
+  /// Starts a new integration from (t, y) with a first step of dt
+  void initialize(Real t, const std::vector<Real> & y, Real dt);
+
+  /**
+   * Takes one successful step that does not pass t_stop (retrying with
+   * smaller steps or a lower order as needed).
+   * @return false if the step size fell below the minimum
+   */
+  bool step(Real t_stop);
+
+  Real time() const { return _t; }
+  Real lastStep() const { return _last_step; }
+  Real nextStep() const { return _h; }
+  unsigned int order() const { return _order; }
+  const std::vector<Real> & solution() const { return _history.front(); }
+
+  unsigned int numSteps() const { return _num_steps; }
+  unsigned int numRejected() const { return _num_rejected; }
+  unsigned int numResiduals() const { return _num_residuals; }
+  unsigned int numJacobians() const { return _num_jacobians; }
+
+  /// In-place LU factorization with partial pivoting of the n x n matrix a
+  static bool luFactor(std::vector<Real> & a, std::vector<unsigned int> & pivot, unsigned int n);
+  /// Solves with a factorization from luFactor, overwriting b
+  static void luSolve(const std::vector<Real> & a, const std::vector<unsigned int> & pivot, std::vector<Real> & b, unsigned int n);
+
+protected:
+  /// Weighted RMS norm of v with the weights of the last accepted solution
+  Real norm(const std::vector<Real> & v) const;
+
+  /// Value at t of the polynomial through the newest num_points accepted solutions
+  void extrapolate(Real t, unsigned int num_points, std::vector<Real> & y) const;
+
+  /// Estimated local error of the BDF method of the given order for the step to (t, y)
+  Real errorEstimate(Real t, const std::vector<Real> & y, unsigned int order, std::vector<Real> & work) const;
+
+  /// Solves the corrector equation; returns false if Newton did not converge
+  bool correct(Real t, unsigned int order, std::vector<Real> & y);
+
+  unsigned int _n;
+  Residual _residual;
+  Jacobian _jacobian;
+
+  Real _rtol;
+  Real _atol;
+  unsigned int _max_order;
+  Real _h_min;
+  Real _h_max;
+
+  Real _t;
+  Real _h;
+  Real _last_step;
+  unsigned int _order;
+  unsigned int _steps_at_order;
+
+  /// Accepted solutions and their times, newest first
+  std::deque<std::vector<Real>> _history;
+  std::deque<Real> _times;
+
+  /// Error weights 1 / (atol + rtol |y|)
+  std::vector<Real> _weight;
+
+  /// Iteration matrix, its factorization and the alpha it was formed with
+  std::vector<Real> _matrix;
+  std::vector<unsigned int> _pivot;
+  Real _matrix_alpha;
+  bool _matrix_current;
+
+  std::vector<Real> _ydot;
+  std::vector<Real> _r;
+  std::vector<Real> _predicted;
+  std::vector<Real> _coefficient;
+
+  unsigned int _num_steps;
+  unsigned int _num_rejected;
+  unsigned int _num_residuals;
+  unsigned int _num_jacobians;
+};
+
+#endif // STIFFBDFINTEGRATOR_H
@@ -0,0 +1,75 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * A fixed set of worker threads that split loops with the calling thread.
+ * run() hands out tasks 0..n-1 (each to exactly one thread) and returns when
+ * all are done, rethrowing the first exception thrown by a task. A run()
+ * issued while the pool is busy, or from one of its tasks, executes serially
+ * on the calling thread, so nested or concurrent callers are safe.
+ *
+ * Tasks must write disjoint outputs; results that do not depend on which
+ * thread ran a task are then independent of the number of threads.
+ */
+class ThreadPool
+{
+public:
+  /// A pool of num_threads threads in total (the caller included)
+  ThreadPool(unsigned int num_threads);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool & operator=(const ThreadPool &) = delete;
+
+  /// The pool shared by every caller asking for num_threads threads
+  static std::shared_ptr<ThreadPool> shared(unsigned int num_threads);
+
+  unsigned int numThreads() const { return _workers.size() + 1; }
+
+  /// Runs task(0) ... task(num_tasks - 1)
+  void run(unsigned int num_tasks, const std::function<void(unsigned int)> & task);
+
+  /**
+   * Runs body(begin, end) over contiguous blocks covering [0, size), of at
+   * least min_block items (up to four blocks per thread, for balance).
+   */
+  void forRange(unsigned int size,
+                unsigned int min_block,
+                const std::function<void(unsigned int, unsigned int)> & body);
+
+protected:
+  /// Worker loop: waits for each new batch of tasks and helps run it
+  void work();
+
+  /// Runs tasks of the current batch until none are left
+  void drain();
+
+  std::vector<std::thread> _workers;
+
+  /// Held by the thread running a batch
+  std::mutex _run_mutex;
+
+  std::mutex _mutex;
+  std::condition_variable _start;
+  std::condition_variable _done;
+  const std::function<void(unsigned int)> * _task;
+  unsigned int _num_tasks;
+  std::atomic<unsigned int> _next;
+  /// Incremented for each batch, so that the workers wake once per batch
+  unsigned long _batch;
+  /// Workers that have not finished the current batch
+  unsigned int _busy;
+  bool _stop;
+  std::exception_ptr _error;
+};
+
+#endif // THREADPOOL_H
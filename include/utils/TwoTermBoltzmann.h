@@ -0,0 +1,122 @@
+#ifndef TWOTERMBOLTZMANN_H
+#define TWOTERMBOLTZMANN_H
+
+#include "LXCatCrossSections.h"
+
+#include <string>
+#include <vector>
+
+/**
+ * Steady-state two-term Boltzmann solver for the electron energy
+ * distribution function (EEDF) in a uniform DC field, following
+ * Hagelaar & Pitchford, Plasma Sources Sci. Technol. 14 (2005) 722.
+ *
+ * The EEDF F0 (eV^-3/2, normalized so that int sqrt(u) F0 du = 1) is
+ * discretized on a uniform energy grid with the exponential
+ * (Scharfetter-Gummel) scheme for the drift-diffusion flux. Inelastic
+ * processes move electrons down by their threshold energy, ionization
+ * (one-takes-all) adds a secondary electron at zero energy, and net
+ * ionization/attachment is treated as exponential temporal growth.
+ * Electron-electron collisions are not included.
+ *
+ * Cross sections are interpolated onto the grid once, so a solve only
+ * assembles and factorizes one small dense matrix per growth-rate iteration.
+ * For a given growth rate the EEDF follows from a direct solve, so there is
+ * no distribution to warm-start from; only the growth-rate iteration starts
+ * from the previous solve's value (which settles it in one iteration when
+ * the conditions have not changed).
+ */
+class TwoTermBoltzmann
+{
+public:
+  /**
+   * @param cross_sections Processes to include (those of species not in
+   *        species are ignored)
+   * @param species Gas species, in the order of the mole fractions passed to solve()
+   * @param num_cells Number of energy cells
+   * @param max_energy Upper end of the energy grid (eV)
+   */
+  TwoTermBoltzmann(const LXCatCrossSections & cross_sections,
+                   const std::vector<std::string> & species,
+                   unsigned int num_cells,
+                   Real max_energy);
+
+  /**
+   * Computes the EEDF.
+   * @param reduced_field E/N (V m^2)
+   * @param mole_fractions Mole fraction of each species
+   * @param gas_temperature Gas temperature (K)
+   * @return the number of growth-rate iterations taken
+   */
+  unsigned int solve(Real reduced_field, const std::vector<Real> & mole_fractions, Real gas_temperature);
+
+  /// Rate coefficient (m^3/s) of a process, by index in the cross section set
+  Real rateCoefficient(unsigned int collision) const;
+
+  /// Mean electron energy (eV)
+  Real meanEnergy() const;
+
+  /// Reduced mobility mu*N (1/(m V s))
+  Real reducedMobility() const;
+
+  /// Net ionization minus attachment rate coefficient (m^3/s), weighted by mole fraction
+  Real growthRate() const { return _growth; }
+
+  const std::vector<Real> & eedf() const { return _f; }
+  const std::vector<Real> & energy() const { return _u; }
+
+  /// Drops the previous growth rate so that the next solve starts from zero
+  void reset();
+
+protected:
+  /// Builds and solves the linear system for a fixed growth rate
+  void solveLinear(Real reduced_field, Real kT, Real growth);
+
+  /// Net growth rate of the current EEDF
+  Real computeGrowth() const;
+
+  /// Dense LU solve with partial pivoting (a is overwritten)
+  static void luSolve(std::vector<Real> & a, std::vector<Real> & b, unsigned int n);
+
+  /// One inelastic process on the grid
+  struct Process
+  {
+    /// Index in the cross section set
+    unsigned int collision;
+    /// Species index (for the mole fraction)
+    unsigned int species;
+    LXCatCrossSections::Kind kind;
+    /// Lower cell receiving the scattered electrons of each cell, and its
+    /// weight (the rest goes to the cell above)
+    std::vector<unsigned int> target;
+    std::vector<Real> weight;
+  };
+
+  unsigned int _n;
+  Real _du;
+  /// Cell centres and interior cell boundaries
+  std::vector<Real> _u;
+  std::vector<Real> _ub;
+
+  unsigned int _num_species;
+  std::vector<Process> _processes;
+  /// Total momentum transfer and elastic energy loss (2 m/M sigma_el) per species at boundaries
+  std::vector<std::vector<Real>> _sigma_m;
+  std::vector<std::vector<Real>> _sigma_eps;
+  /// gamma * du * u_j * sigma(u_j) of every collision (empty if its species is not in the gas)
+  std::vector<std::vector<Real>> _collision_loss;
+  std::vector<int> _collision_species;
+
+  std::vector<Real> _mole_fractions;
+  std::vector<Real> _f;
+  Real _growth;
+  bool _have_solution;
+  /// sigma~_m at the boundaries for the last solve (used by the mobility)
+  std::vector<Real> _sigma_tilde;
+
+  /// Scratch for the linear system
+  std::vector<Real> _matrix;
+  std::vector<Real> _rhs;
+};
+
+#endif // TWOTERMBOLTZMANN_H
@@ -0,0 +1,56 @@
+#ifndef REACTIONRATEOFPROGRESS_H
+#define REACTIONRATEOFPROGRESS_H
+
+#include "GeneralVectorPostprocessor.h"
+#include "ReactionNetwork.h"
+
+#include <fstream>
+
+// Forward Declarations
+class ReactionRateOfProgress;
+
+template <>
+InputParameters validParams<ReactionRateOfProgress>();
+
+/**
+ * Records the rate of progress of every reaction of a scalar network and the
+ * production and destruction rate of every species. Each execution replaces
+ * the single row of the vectors: a time column, a rate<r> column per
+ * reaction (numbered as the rate_constant<r> variables) and
+ * <species>_production and <species>_destruction columns. With file_name,
+ * the row is also appended to a single CSV file, so the history is kept on
+ * disk rather than in the vectors.
+ */
+class ReactionRateOfProgress : public GeneralVectorPostprocessor
+{
+public:
+  ReactionRateOfProgress(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void initialize() override {}
+  virtual void execute() override;
+
+protected:
+  unsigned int _num_species;
+  unsigned int _num_reactions;
+  std::vector<const VariableValue *> _species_value;
+  std::vector<const VariableValue *> _rate_coefficient;
+  Real _n_gas;
+  bool _use_log;
+
+  ReactionNetwork _network;
+
+  std::vector<Real> _density;
+  std::vector<Real> _rate_values;
+  std::vector<Real> _rates;
+
+  VectorPostprocessorValue & _time_column;
+  std::vector<VectorPostprocessorValue *> _rate_column;
+  std::vector<VectorPostprocessorValue *> _production_column;
+  std::vector<VectorPostprocessorValue *> _destruction_column;
+
+  /// The CSV file the rows are appended to (open on the first processor only)
+  std::ofstream _file;
+};
+
+#endif // REACTIONRATEOFPROGRESS_H
@@ -0,0 +1,160 @@
+# Argon ionization at 100 Td with the EEDF rate coefficient tabulated by the
+# built-in two-term Boltzmann solver (simplified cross sections in argon.dat).
+# The ionization fraction passed to the solver changes every step, so the
+# solver re-runs every step. The two-term solver neglects electron-electron
+# collisions, so every re-run gives the same table, and a run with
+# asynchronous_boltzmann = true (whose tables lag by one step) must match one
+# without. So must runs that skip the re-runs (boltzmann_drift_tolerance) or
+# take the tables from the cache (boltzmann_cache_resolution); those are
+# compared on the postprocessors, which include the staleness of the tables.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[]
+
+[Variables]
+  [./e]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 1e12
+    scaling = 1e-12
+  [../]
+
+  [./Ar+]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 1e12
+    scaling = 1e-12
+  [../]
+
+  [./Ar]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 2.5e25
+    scaling = 4e-26
+  [../]
+[]
+
+[ScalarKernels]
+  [./de_dt]
+    type = ODETimeDerivative
+    variable = e
+  [../]
+
+  [./dAr+_dt]
+    type = ODETimeDerivative
+    variable = Ar+
+  [../]
+
+  [./dAr_dt]
+    type = ODETimeDerivative
+    variable = Ar
+  [../]
+[]
+
+[ChemicalReactions]
+  [./ScalarNetwork]
+    species = 'e Ar+ Ar'
+    electron_density = 'e'
+    use_bolsig = true
+    boltzmann_solver = 'two_term'
+    cross_section_data = 'argon'
+    gas_species = 'Ar'
+    maximum_energy = 100
+    output_table = true
+    table_variable = 'reduced_field'
+    table_maximum = 300
+    table_points = 40
+    reduced_field = 'reduced_field'
+    neutral_density = 'neutral_density'
+    ionization_fraction = 'ionization_fraction'
+    mole_fractions = 'x_Ar'
+    reactions = 'e + Ar -> e + e + Ar+         : EEDF (Ionization 15.76 eV)
+                 e + Ar+ + Ar -> Ar + Ar       : 1e-43'
+  [../]
+[]
+
+[AuxVariables]
+  [./reduced_field]
+    order = FIRST
+    family = SCALAR
+    initial_condition = 100e-21
+  [../]
+
+  [./neutral_density]
+    order = FIRST
+    family = SCALAR
+    initial_condition = 2.5e25
+  [../]
+
+  [./ionization_fraction]
+    order = FIRST
+    family = SCALAR
+  [../]
+
+  [./x_Ar]
+    order = FIRST
+    family = SCALAR
+    initial_condition = 1
+  [../]
+[]
+
+[Functions]
+  [./ionization_fraction]
+    type = ParsedFunction
+    value = '4e-14 * (1 + t / 1e-10)'
+  [../]
+[]
+
+[AuxScalarKernels]
+  [./ionization_fraction]
+    type = FunctionScalarAux
+    variable = ionization_fraction
+    function = ionization_fraction
+    execute_on = 'INITIAL TIMESTEP_BEGIN'
+  [../]
+[]
+
+[Postprocessors]
+  [./e]
+    type = ScalarVariable
+    variable = e
+    outputs = 'csv'
+  [../]
+
+  [./Ar+]
+    type = ScalarVariable
+    variable = Ar+
+    outputs = 'csv'
+  [../]
+
+  [./rate_staleness]
+    type = BoltzmannRateStaleness
+    measure = 'steps'
+    outputs = 'csv'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 10
+  dt = 1e-10
+  solve_type = 'newton'
+  nl_rel_tol = 1e-12
+  petsc_options_iname = '-snes_linesearch_type'
+  petsc_options_value = 'basic'
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Outputs]
+  exodus = true
+  csv = true
+[]
@@ -0,0 +1,110 @@
+# Argon reaction-diffusion on a small 1D mesh with the rate coefficients of
+# the EEDF reactions taken from one material per reaction. The tests file runs
+# it once as is (the reference) and once with fused_eedf_materials = true,
+# which must give the same solution. The reduced field varies along the
+# domain so that every element samples the tables at a different point.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 10
+  xmax = 1
+[]
+
+[Variables]
+  [./e]
+    initial_condition = 36.84
+  [../]
+  [./Ar+]
+    initial_condition = 36.84
+  [../]
+  [./Ar*]
+    initial_condition = 34.54
+  [../]
+[]
+
+[AuxVariables]
+  [./reduced_field]
+  [../]
+[]
+
+[ICs]
+  [./reduced_field]
+    type = FunctionIC
+    variable = reduced_field
+    function = '1e-20 + 2e-20 * x'
+  [../]
+[]
+
+[Kernels]
+  [./e_time]
+    type = TimeDerivativeLog
+    variable = e
+  [../]
+  [./e_diffusion]
+    type = Diffusion
+    variable = e
+  [../]
+  [./Ar+_time]
+    type = TimeDerivativeLog
+    variable = Ar+
+  [../]
+  [./Ar+_diffusion]
+    type = Diffusion
+    variable = Ar+
+  [../]
+  [./Ar*_time]
+    type = TimeDerivativeLog
+    variable = Ar*
+  [../]
+  [./Ar*_diffusion]
+    type = Diffusion
+    variable = Ar*
+  [../]
+[]
+
+[ChemicalReactions]
+  [./Network]
+    species = 'e Ar+ Ar*'
+    use_log = true
+    electron_density = 'e'
+    reaction_coefficient_format = 'rate'
+    file_location = '../../problems/Example3'
+    sampling_variable = 'reduced_field'
+    reactions = 'e + Ar -> e + e + Ar+   : EEDF
+                 e + Ar -> Ar* + e       : EEDF
+                 e + Ar* -> Ar + e       : EEDF
+                 e + Ar* -> Ar+ + e + e  : EEDF
+                 Ar+ + e -> Ar*          : 1e-17
+                 Ar* + Ar* -> Ar+ + e    : 6.0e-16'
+  [../]
+[]
+
+[Materials]
+  [./gas]
+    type = GenericConstantMaterial
+    prop_names = 'n_gas massem'
+    prop_values = '2.447e25 9.11e-31'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'newton'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  num_steps = 5
+  dt = 1e-9
+  nl_rel_tol = 1e-12
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Outputs]
+  exodus = true
+[]
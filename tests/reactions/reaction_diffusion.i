@@ -0,0 +1,124 @@
+# Ionization and recombination with diffusion on the left block of a 1D
+# mesh, with a diffusing variable on both blocks, so that the right block has
+# nodes without species. The tests file runs it once with the reaction
+# kernels (the reference), then with operator_split = true and with
+# nodal_reactions = true. Both must reproduce the reference to the splitting
+# and mass lumping errors.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 20
+  xmax = 1
+[]
+
+[MeshModifiers]
+  [./right]
+    type = SubdomainBoundingBox
+    bottom_left = '0.6 -1 0'
+    top_right = '1 1 0'
+    block_id = 1
+  [../]
+[]
+
+[Variables]
+  [./e]
+    block = 0
+  [../]
+  [./Ar+]
+    block = 0
+  [../]
+  [./u]
+  [../]
+[]
+
+[ICs]
+  [./e]
+    type = FunctionIC
+    variable = e
+    function = '1 + 2 * x'
+  [../]
+  [./Ar+]
+    type = FunctionIC
+    variable = Ar+
+    function = '2 - x'
+  [../]
+  [./u]
+    type = FunctionIC
+    variable = u
+    function = 'x'
+  [../]
+[]
+
+[Kernels]
+  [./e_time]
+    type = TimeDerivative
+    variable = e
+  [../]
+  [./e_diffusion]
+    type = Diffusion
+    variable = e
+  [../]
+  [./Ar+_time]
+    type = TimeDerivative
+    variable = Ar+
+  [../]
+  [./Ar+_diffusion]
+    type = Diffusion
+    variable = Ar+
+  [../]
+  [./u_time]
+    type = TimeDerivative
+    variable = u
+  [../]
+  [./u_diffusion]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[ChemicalReactions]
+  [./Network]
+    species = 'e Ar+'
+    block = 0
+    use_log = false
+    electron_density = 'e'
+    reaction_coefficient_format = 'rate'
+    n_gas = 2.5e25
+    reactions = 'e + Ar -> e + e + Ar+   : 1e-25
+                 e + Ar+ -> Ar           : 1.0'
+  [../]
+[]
+
+[Materials]
+  [./gas]
+    type = GenericConstantMaterial
+    prop_names = 'n_gas'
+    prop_values = '2.5e25'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'newton'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  num_steps = 20
+  dt = 1e-3
+  nl_rel_tol = 1e-12
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+# Only the variables common to every variant
+[Outputs]
+  [./out]
+    type = Exodus
+    show = 'e Ar+ u'
+  [../]
+[]
@@ -0,0 +1,85 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  xmin = 0
+  xmax = 1
+  nx = 1
+[]
+
+[Variables]
+  [./H2]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 1e15
+    scaling = 1e-15
+  [../]
+
+  [./O2]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 1e15
+    scaling = 1e-15
+  [../]
+
+  [./OH]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 0
+    scaling = 1e-15
+  [../]
+[]
+
+[ScalarKernels]
+  [./dH2_dt]
+    type = ODETimeDerivative
+    variable = H2
+  [../]
+
+  [./dO2_dt]
+    type = ODETimeDerivative
+    variable = O2
+  [../]
+
+  [./dOH_dt]
+    type = ODETimeDerivative
+    variable = OH
+  [../]
+[]
+
+[ChemicalReactions]
+  [./ScalarNetwork]
+    species = 'H2 O2 OH'
+    equation_variables = 'Tgas'
+    reactions_file = 'hydrogen.inp'
+    reactions_format = chemkin
+  [../]
+[]
+
+[AuxVariables]
+  [./Tgas]
+    order = FIRST
+    family = SCALAR
+    initial_condition = 300
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  end_time = 1e-2
+  dt = 1e-4
+  solve_type = 'newton'
+  nl_rel_tol = 1e-10
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Outputs]
+  [./out]
+    type = Exodus
+  [../]
+[]
@@ -0,0 +1,77 @@
+# Jacobian check of the fused network when rate equations depend on a
+# nonlinear variable (the gas temperature T): the derivatives of the rates
+# with respect to T come from FParser AutoDiff, and the off-diagonal blocks
+# from the sparsity of the network (sparse_preconditioning).
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[]
+
+[Variables]
+  [./A]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 1
+  [../]
+  [./B]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 2
+  [../]
+  [./C]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 0.5
+  [../]
+  [./T]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 300
+  [../]
+[]
+
+[ScalarKernels]
+  [./dA_dt]
+    type = ODETimeDerivative
+    variable = A
+  [../]
+  [./dB_dt]
+    type = ODETimeDerivative
+    variable = B
+  [../]
+  [./dC_dt]
+    type = ODETimeDerivative
+    variable = C
+  [../]
+  [./dT_dt]
+    type = ODETimeDerivative
+    variable = T
+  [../]
+  [./T_relaxation]
+    type = ParsedODEKernel
+    variable = T
+    function = '10 * (T - 400)'
+  [../]
+[]
+
+[ChemicalReactions]
+  [./ScalarNetwork]
+    species = 'A B C'
+    equation_variables = 'T'
+    fused_network = true
+    sparse_preconditioning = true
+
+    reactions = 'A + B -> C  : {2 * exp(-100 / T)}
+                 C -> A + B  : {(T / 300)^2}
+                 A -> B      : 0.5'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'newton'
+  num_steps = 1
+  dt = 1e-2
+[]
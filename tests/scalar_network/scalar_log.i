@@ -0,0 +1,65 @@
+# Log-form decay of A through reactions with the untracked background gas
+# (n_gas = 3.219e18): ln A = -(k1 n_gas + k2 n_gas^2) t exactly, also for
+# the backward Euler steps. The rates of progress of every step are
+# checked too.
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  xmin = 0
+  xmax = 1
+  nx = 1
+[]
+
+[Variables]
+  [./A]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 0
+  [../]
+[]
+
+[ScalarKernels]
+  [./dA_dt]
+    type = ODETimeDerivativeLog
+    variable = A
+  [../]
+[]
+
+[ChemicalReactions]
+  [./ScalarNetwork]
+    species = 'A'
+    use_log = true
+    rate_of_progress = true
+    reactions = 'A + M -> B      : 1e-18
+                 A + M + M -> B  : 1e-37'
+  [../]
+[]
+
+[Postprocessors]
+  [./A_value]
+    type = ScalarVariable
+    variable = A
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  end_time = 1
+  dt = 0.1
+  solve_type = 'newton'
+  nl_rel_tol = 1e-12
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Outputs]
+  [./out]
+    type = CSV
+    show = 'A_value'
+  [../]
+[]
@@ -0,0 +1,15 @@
+#ifndef ALLOCATIONCOUNTER_H
+#define ALLOCATIONCOUNTER_H
+
+#include <cstddef>
+
+/**
+ * Number of calls to the global operator new (in all its forms) made so far
+ * by the unit executable, which replaces the operators to count them.
+ */
+namespace AllocationCounter
+{
+std::size_t count();
+}
+
+#endif // ALLOCATIONCOUNTER_H
@@ -0,0 +1,120 @@
+#ifndef CRANEOBJECTUNITTEST_H
+#define CRANEOBJECTUNITTEST_H
+
+#include "gtest/gtest.h"
+
+#include "AppFactory.h"
+#include "AuxiliarySystem.h"
+#include "FEProblem.h"
+#include "GeneratedMesh.h"
+#include "MaterialWarehouse.h"
+#include "MooseApp.h"
+#include "MooseUtils.h"
+#include "MooseVariable.h"
+#include "MooseVariableScalar.h"
+#include "NonlinearSystemBase.h"
+
+#include "libmesh/system.h"
+
+/**
+ * A one-element problem in which single Crane objects can be built and
+ * called directly. Variables and objects are added first, then initProblem()
+ * sets up the systems, after which variable values can be set and the
+ * objects driven through their public compute methods.
+ */
+class CraneObjectUnitTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    const char * argv[2] = {"foo", "\0"};
+    _app = AppFactory::createAppShared("CraneApp", 1, (char **)argv);
+    _factory = &_app->getFactory();
+
+    InputParameters mesh_params = _factory->getValidParams("GeneratedMesh");
+    mesh_params.set<MooseEnum>("dim") = "1";
+    mesh_params.set<unsigned int>("nx") = 1;
+    mesh_params.set<std::string>("_object_name") = "mesh";
+    _mesh = libmesh_make_unique<GeneratedMesh>(mesh_params);
+    _mesh->init();
+
+    InputParameters problem_params = _factory->getValidParams("FEProblem");
+    problem_params.set<MooseMesh *>("mesh") = _mesh.get();
+    problem_params.set<std::string>("_object_name") = "problem";
+    _fe_problem = _factory->create<FEProblem>("FEProblem", "problem", problem_params);
+    _fe_problem->createQRules(QGAUSS, SECOND);
+  }
+
+  /// The Example3 tables (the tests run from the repository or unit directory)
+  static std::string example3()
+  {
+    return MooseUtils::pathExists("problems/Example3") ? "problems/Example3" : "../problems/Example3";
+  }
+
+  /// Files of the unit tests themselves
+  static std::string unitData()
+  {
+    return MooseUtils::pathExists("unit/data") ? "unit/data" : "data";
+  }
+
+  void initProblem()
+  {
+    _fe_problem->init();
+    _fe_problem->getNonlinearSystemBase().solution().zero();
+  }
+
+  /// Sets every component of a (nonlinear or auxiliary) scalar variable
+  void setScalar(const std::string & name, Real value)
+  {
+    MooseVariableScalar & var = _fe_problem->getScalarVariable(0, name);
+    var.reinit();
+    var.setValues(value);
+    var.insert(var.sys().solution());
+    var.sys().solution().close();
+    var.sys().system().update();
+  }
+
+  /// Sets every nodal value of an auxiliary field variable
+  void setField(const std::string & name, Real value)
+  {
+    AuxiliarySystem & aux = _fe_problem->getAuxiliarySystem();
+    const unsigned int number = aux.getVariable(0, name).number();
+    for (const auto & node : _mesh->getMesh().node_ptr_range())
+      aux.solution().set(node->dof_number(aux.number(), number, 0), value);
+    aux.solution().close();
+    aux.system().update();
+  }
+
+  /// Parameters of an object created directly, as FEProblemBase would pass them
+  InputParameters objectParams(const std::string & type, SystemBase & sys)
+  {
+    InputParameters params = _factory->getValidParams(type);
+    params.set<FEProblemBase *>("_fe_problem_base") = _fe_problem.get();
+    params.set<SubProblem *>("_subproblem") = _fe_problem.get();
+    params.set<SystemBase *>("_sys") = &sys;
+    params.set<THREAD_ID>("_tid") = 0;
+    return params;
+  }
+
+  /// Reinitializes the element and computes all the materials on it
+  void reinitMaterials()
+  {
+    const Elem * elem = _mesh->elemPtr(0);
+    _fe_problem->prepare(elem, 0);
+    _fe_problem->reinitElem(elem, 0);
+    _fe_problem->prepareMaterials(elem->subdomain_id(), 0);
+    _fe_problem->reinitMaterials(elem->subdomain_id(), 0);
+  }
+
+  std::shared_ptr<Material> material(const std::string & name)
+  {
+    return _fe_problem->getMaterialWarehouse().getActiveObject(name, 0);
+  }
+
+  std::unique_ptr<MooseMesh> _mesh;
+  std::shared_ptr<MooseApp> _app;
+  Factory * _factory;
+  std::shared_ptr<FEProblem> _fe_problem;
+};
+
+#endif // CRANEOBJECTUNITTEST_H
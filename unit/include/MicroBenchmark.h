@@ -0,0 +1,66 @@
+#ifndef MICROBENCHMARK_H
+#define MICROBENCHMARK_H
+
+#include "AllocationCounter.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+/// Per-call cost of a benchmarked routine
+struct MicroBenchmarkResult
+{
+  double ns_per_call;
+  double allocations_per_call;
+  unsigned long iterations;
+};
+
+/**
+ * Times calls of f in the manner of Google Benchmark: after a warm-up call the
+ * number of iterations is grown until a batch runs for at least the minimum
+ * time (0.2 s, or CRANE_BENCHMARK_MIN_TIME seconds), and the last batch is
+ * reported as "<name>  <ns>/call  <allocations>/call".
+ *
+ * f returns the computed value, which is accumulated so that the calls are
+ * not optimized away.
+ */
+template <typename F>
+MicroBenchmarkResult
+runMicroBenchmark(const std::string & name, F && f)
+{
+  double min_time = 0.2;
+  if (const char * value = std::getenv("CRANE_BENCHMARK_MIN_TIME"))
+    min_time = std::atof(value);
+
+  volatile double sink = f();
+
+  MicroBenchmarkResult result{0.0, 0.0, 0};
+  for (unsigned long iterations = 1;; iterations *= 2)
+  {
+    const std::size_t allocations = AllocationCounter::count();
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned long i = 0; i < iterations; ++i)
+      sink = sink + f();
+    const auto stop = std::chrono::steady_clock::now();
+    const std::size_t allocated = AllocationCounter::count() - allocations;
+
+    const double elapsed = std::chrono::duration<double>(stop - start).count();
+    if (elapsed >= min_time || iterations >= (1ul << 40))
+    {
+      result.ns_per_call = 1e9 * elapsed / iterations;
+      result.allocations_per_call = static_cast<double>(allocated) / iterations;
+      result.iterations = iterations;
+      break;
+    }
+  }
+
+  std::printf("%-40s %12.1f ns/call %10.2f allocations/call (%lu calls)\n",
+              name.c_str(),
+              result.ns_per_call,
+              result.allocations_per_call,
+              result.iterations);
+  return result;
+}
+
+#endif // MICROBENCHMARK_H